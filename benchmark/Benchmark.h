@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_BENCHMARK_H
+#define SFML_BENCHMARK_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System.h>
+#include <stdio.h>
+
+
+////////////////////////////////////////////////////////////
+// Run a function repeatedly for about half a second, and
+// return the average duration of a call in microseconds
+////////////////////////////////////////////////////////////
+static double Measure(void (*function)(void*), void* data)
+{
+    sfClock* clock;
+    unsigned int calls = 0;
+    sfInt64 elapsed;
+
+    // Warm-up call, to fill the caches and trigger lazy initializations
+    function(data);
+
+    clock = sfClock_Create();
+    do
+    {
+        function(data);
+        calls++;
+        elapsed = sfTime_AsMicroseconds(sfClock_GetElapsedTime(clock));
+    }
+    while (elapsed < 500000);
+    sfClock_Destroy(clock);
+
+    return (double)elapsed / calls;
+}
+
+
+////////////////////////////////////////////////////////////
+// Print the result of a comparison between the current
+// way of doing an operation and the new one
+////////////////////////////////////////////////////////////
+static void Report(const char* name, double current, double optimized)
+{
+    printf("%-32s %12.1f us %12.1f us %8.2fx\n", name, current, optimized, current / optimized);
+}
+
+
+////////////////////////////////////////////////////////////
+// Print the header of the table printed by Report
+////////////////////////////////////////////////////////////
+static void ReportHeader(void)
+{
+    printf("%-32s %15s %15s %9s\n", "Operation", "Current", "New", "Speed-up");
+}
+
+
+#endif // SFML_BENCHMARK_H
@@ -0,0 +1,230 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Measure how many images per second are decoded by
+// sfImage_CreateFromFilesBatch and sfImage_CreateFromMemoryBatch
+// with an increasing number of threads, compared to calling
+// sfImage_CreateFromFile for each file
+//
+// Usage: csfml-benchmark-imagebatch [maxThreads [file1 file2 ...]]
+// Without files, PNG images are generated in the working directory
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <Benchmark.h>
+#include <SFML/Graphics.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+////////////////////////////////////////////////////////////
+// Number and size of the generated images
+////////////////////////////////////////////////////////////
+#define GENERATED_COUNT 256
+#define GENERATED_SIZE  256
+
+
+////////////////////////////////////////////////////////////
+// Data shared by the benchmarked functions
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    const char** Filenames;
+    const void** Data;
+    size_t*      Sizes;
+    size_t       Count;
+    sfImage**    Images;
+    unsigned int ThreadCount;
+} Data;
+
+
+////////////////////////////////////////////////////////////
+static void DestroyImages(Data* data)
+{
+    size_t i;
+
+    for (i = 0; i < data->Count; ++i)
+    {
+        if (data->Images[i])
+            sfImage_Destroy(data->Images[i]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+static void LoadOneByOne(void* userData)
+{
+    Data* data = (Data*)userData;
+    size_t i;
+
+    for (i = 0; i < data->Count; ++i)
+        data->Images[i] = sfImage_CreateFromFile(data->Filenames[i]);
+    DestroyImages(data);
+}
+
+
+////////////////////////////////////////////////////////////
+static void LoadFilesBatch(void* userData)
+{
+    Data* data = (Data*)userData;
+
+    sfImage_CreateFromFilesBatch(data->Filenames, data->Count, data->ThreadCount, data->Images);
+    DestroyImages(data);
+}
+
+
+////////////////////////////////////////////////////////////
+static void LoadMemoryBatch(void* userData)
+{
+    Data* data = (Data*)userData;
+
+    sfImage_CreateFromMemoryBatch(data->Data, data->Sizes, data->Count, data->ThreadCount, data->Images);
+    DestroyImages(data);
+}
+
+
+////////////////////////////////////////////////////////////
+// Write the generated images, and return their filenames
+////////////////////////////////////////////////////////////
+static const char** GenerateImages(size_t count)
+{
+    const char** filenames = malloc(count * sizeof(const char*));
+    sfUint8* pixels = malloc(GENERATED_SIZE * GENERATED_SIZE * 4);
+    size_t i, j;
+
+    for (i = 0; i < count; ++i)
+    {
+        char* filename = malloc(32);
+        sfImage* image;
+
+        // Smooth gradients with some noise, to get a realistic compression ratio
+        for (j = 0; j < GENERATED_SIZE * GENERATED_SIZE; ++j)
+        {
+            size_t x = j % GENERATED_SIZE;
+            size_t y = j / GENERATED_SIZE;
+            pixels[j * 4]     = (sfUint8)(x + i);
+            pixels[j * 4 + 1] = (sfUint8)(y * 2);
+            pixels[j * 4 + 2] = (sfUint8)((x + y) / 2 + rand() % 8);
+            pixels[j * 4 + 3] = 255;
+        }
+
+        sprintf(filename, "csfml-benchmark-%u.png", (unsigned int)i);
+        image = sfImage_CreateFromPixels(GENERATED_SIZE, GENERATED_SIZE, pixels);
+        sfImage_SaveToFile(image, filename);
+        sfImage_Destroy(image);
+        filenames[i] = filename;
+    }
+
+    free(pixels);
+
+    return filenames;
+}
+
+
+////////////////////////////////////////////////////////////
+// Read a whole file in memory
+////////////////////////////////////////////////////////////
+static void* ReadFile(const char* filename, size_t* size)
+{
+    FILE* file = fopen(filename, "rb");
+    void* data = NULL;
+
+    *size = 0;
+    if (file)
+    {
+        fseek(file, 0, SEEK_END);
+        *size = (size_t)ftell(file);
+        fseek(file, 0, SEEK_SET);
+        data = malloc(*size > 0 ? *size : 1);
+        if (fread(data, 1, *size, file) != *size)
+            *size = 0;
+        fclose(file);
+    }
+
+    return data;
+}
+
+
+////////////////////////////////////////////////////////////
+int main(int argc, char** argv)
+{
+    Data data;
+    unsigned int maxThreads = (argc > 1) ? (unsigned int)atoi(argv[1]) : 16;
+    int generated = argc <= 2;
+    double current;
+    size_t i;
+
+    if (generated)
+    {
+        data.Count = GENERATED_COUNT;
+        printf("Generating %u images...\n", (unsigned int)data.Count);
+        data.Filenames = GenerateImages(data.Count);
+    }
+    else
+    {
+        data.Count = (size_t)(argc - 2);
+        data.Filenames = (const char**)(argv + 2);
+    }
+
+    data.Images = malloc(data.Count * sizeof(sfImage*));
+    data.Data = malloc(data.Count * sizeof(const void*));
+    data.Sizes = malloc(data.Count * sizeof(size_t));
+    for (i = 0; i < data.Count; ++i)
+        data.Data[i] = ReadFile(data.Filenames[i], &data.Sizes[i]);
+
+    printf("Decoding %u images\n\n", (unsigned int)data.Count);
+
+    current = Measure(LoadOneByOne, &data);
+    printf("%-12s %16s %16s %16s\n", "Threads", "Files (img/s)", "Memory (img/s)", "Speed-up");
+    printf("%-12s %16.1f %16s %16s\n", "one by one", data.Count * 1e6 / current, "-", "1.00x");
+
+    for (data.ThreadCount = 1; data.ThreadCount <= maxThreads; data.ThreadCount *= 2)
+    {
+        double files = Measure(LoadFilesBatch, &data);
+        double memory = Measure(LoadMemoryBatch, &data);
+        printf("%-12u %16.1f %16.1f %15.2fx\n", data.ThreadCount, data.Count * 1e6 / files, data.Count * 1e6 / memory, current / files);
+    }
+
+    for (i = 0; i < data.Count; ++i)
+        free((void*)data.Data[i]);
+    free(data.Sizes);
+    free(data.Data);
+    free(data.Images);
+
+    if (generated)
+    {
+        for (i = 0; i < data.Count; ++i)
+        {
+            remove(data.Filenames[i]);
+            free((void*)data.Filenames[i]);
+        }
+        free(data.Filenames);
+    }
+
+    return EXIT_SUCCESS;
+}
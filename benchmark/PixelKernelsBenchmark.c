@@ -0,0 +1,389 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Compare the vectorized sfImage pixel operations with the
+// scalar loops they replace: the per-pixel code of sf::Image
+// for the operations that already existed, and per-pixel
+// sfImage_GetPixel / sfImage_SetPixel calls for the new
+// bulk operations
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <Benchmark.h>
+#include <SFML/Graphics.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+////////////////////////////////////////////////////////////
+// Data shared by the benchmarked functions
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    unsigned int Width;
+    unsigned int Height;
+    sfImage*     Image;   // image processed by the CSFML functions
+    sfImage*     Source;  // image blended over Image by the copies
+    sfUint8*     Pixels;  // copy of the pixels of Image, processed by the scalar loops
+    sfColor      Key;
+    sfColor      Color;
+} Data;
+
+
+////////////////////////////////////////////////////////////
+static void MaskCurrent(void* userData)
+{
+    Data* data = (Data*)userData;
+    size_t size = (size_t)data->Width * data->Height * 4;
+    sfUint8* pixel;
+
+    for (pixel = data->Pixels; pixel < data->Pixels + size; pixel += 4)
+    {
+        if ((pixel[0] == data->Key.r) && (pixel[1] == data->Key.g) && (pixel[2] == data->Key.b) && (pixel[3] == data->Key.a))
+            pixel[3] = 0;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+static void MaskNew(void* userData)
+{
+    Data* data = (Data*)userData;
+
+    sfImage_CreateMaskFromColor(data->Image, data->Key, 0);
+}
+
+
+////////////////////////////////////////////////////////////
+static void FlipHorizontallyCurrent(void* userData)
+{
+    Data* data = (Data*)userData;
+    size_t rowSize = (size_t)data->Width * 4;
+    unsigned int x, y, c;
+
+    for (y = 0; y < data->Height; ++y)
+    {
+        sfUint8* left = data->Pixels + y * rowSize;
+        sfUint8* right = left + rowSize - 4;
+        for (x = 0; x < data->Width / 2; ++x, left += 4, right -= 4)
+        {
+            for (c = 0; c < 4; ++c)
+            {
+                sfUint8 component = left[c];
+                left[c] = right[c];
+                right[c] = component;
+            }
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+static void FlipHorizontallyNew(void* userData)
+{
+    Data* data = (Data*)userData;
+
+    sfImage_FlipHorizontally(data->Image);
+}
+
+
+////////////////////////////////////////////////////////////
+static void FlipVerticallyCurrent(void* userData)
+{
+    Data* data = (Data*)userData;
+    size_t rowSize = (size_t)data->Width * 4;
+    sfUint8* top = data->Pixels;
+    sfUint8* bottom = data->Pixels + (data->Height - 1) * rowSize;
+    size_t i;
+
+    for (; top < bottom; top += rowSize, bottom -= rowSize)
+    {
+        for (i = 0; i < rowSize; ++i)
+        {
+            sfUint8 component = top[i];
+            top[i] = bottom[i];
+            bottom[i] = component;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+static void FlipVerticallyNew(void* userData)
+{
+    Data* data = (Data*)userData;
+
+    sfImage_FlipVertically(data->Image);
+}
+
+
+////////////////////////////////////////////////////////////
+static void CopyCurrent(void* userData)
+{
+    Data* data = (Data*)userData;
+    size_t count = (size_t)data->Width * data->Height;
+    const sfUint8* src = sfImage_GetPixelsPtr(data->Source);
+    sfUint8* dst = data->Pixels;
+    size_t i;
+
+    for (i = 0; i < count; ++i, src += 4, dst += 4)
+    {
+        unsigned int alpha = src[3];
+        dst[0] = (sfUint8)((src[0] * alpha + dst[0] * (255 - alpha)) / 255);
+        dst[1] = (sfUint8)((src[1] * alpha + dst[1] * (255 - alpha)) / 255);
+        dst[2] = (sfUint8)((src[2] * alpha + dst[2] * (255 - alpha)) / 255);
+        dst[3] = (sfUint8)(alpha + dst[3] * (255 - alpha) / 255);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+static void CopyNew(void* userData)
+{
+    Data* data = (Data*)userData;
+    sfIntRect whole = {0, 0, 0, 0};
+
+    sfImage_CopyImage(data->Image, data->Source, 0, 0, whole, sfTrue);
+}
+
+
+////////////////////////////////////////////////////////////
+static void PremultiplyCurrent(void* userData)
+{
+    Data* data = (Data*)userData;
+    unsigned int x, y;
+
+    for (y = 0; y < data->Height; ++y)
+    {
+        for (x = 0; x < data->Width; ++x)
+        {
+            sfColor color = sfImage_GetPixel(data->Image, x, y);
+            color.r = (sfUint8)((color.r * color.a + 127) / 255);
+            color.g = (sfUint8)((color.g * color.a + 127) / 255);
+            color.b = (sfUint8)((color.b * color.a + 127) / 255);
+            sfImage_SetPixel(data->Image, x, y, color);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+static void PremultiplyNew(void* userData)
+{
+    Data* data = (Data*)userData;
+
+    sfImage_PremultiplyAlpha(data->Image);
+}
+
+
+////////////////////////////////////////////////////////////
+static void SwizzleCurrent(void* userData)
+{
+    Data* data = (Data*)userData;
+    unsigned int x, y;
+
+    for (y = 0; y < data->Height; ++y)
+    {
+        for (x = 0; x < data->Width; ++x)
+        {
+            sfColor color = sfImage_GetPixel(data->Image, x, y);
+            sfColor swapped = color;
+            swapped.r = color.b;
+            swapped.b = color.r;
+            sfImage_SetPixel(data->Image, x, y, swapped);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+static void SwizzleNew(void* userData)
+{
+    Data* data = (Data*)userData;
+
+    sfImage_SwizzleChannels(data->Image, 2, 1, 0, 3);
+}
+
+
+////////////////////////////////////////////////////////////
+static void FillCurrent(void* userData)
+{
+    Data* data = (Data*)userData;
+    unsigned int x, y;
+
+    for (y = 0; y < data->Height; ++y)
+    {
+        for (x = 0; x < data->Width; ++x)
+            sfImage_SetPixel(data->Image, x, y, data->Color);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+static void FillNew(void* userData)
+{
+    Data* data = (Data*)userData;
+    sfIntRect whole = {0, 0, 0, 0};
+
+    sfImage_FillRect(data->Image, whole, data->Color);
+}
+
+
+////////////////////////////////////////////////////////////
+static void BlendCurrent(void* userData)
+{
+    Data* data = (Data*)userData;
+    unsigned int alpha = data->Color.a;
+    unsigned int x, y;
+
+    for (y = 0; y < data->Height; ++y)
+    {
+        for (x = 0; x < data->Width; ++x)
+        {
+            sfColor color = sfImage_GetPixel(data->Image, x, y);
+            color.r = (sfUint8)((data->Color.r * alpha + color.r * (255 - alpha)) / 255);
+            color.g = (sfUint8)((data->Color.g * alpha + color.g * (255 - alpha)) / 255);
+            color.b = (sfUint8)((data->Color.b * alpha + color.b * (255 - alpha)) / 255);
+            color.a = (sfUint8)(alpha + color.a * (255 - alpha) / 255);
+            sfImage_SetPixel(data->Image, x, y, color);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+static void BlendNew(void* userData)
+{
+    Data* data = (Data*)userData;
+    sfIntRect whole = {0, 0, 0, 0};
+
+    sfImage_BlendRect(data->Image, whole, data->Color);
+}
+
+
+////////////////////////////////////////////////////////////
+// Benchmark an operation done in place on the pixels of the
+// image; each path works on its own copy of the pixels, and
+// both results must be identical
+////////////////////////////////////////////////////////////
+static int Compare(Data* data, const char* name, void (*current)(void*), void (*optimized)(void*), sfBool currentUsesImage)
+{
+    size_t size = (size_t)data->Width * data->Height * 4;
+    sfImage* original = data->Image;
+    sfImage* reference;
+    sfImage* result;
+    double currentTime, optimizedTime;
+    int identical;
+
+    // Run each path once from the same pixels, and check that they agree
+    memcpy(data->Pixels, sfImage_GetPixelsPtr(original), size);
+    reference = data->Image = sfImage_Copy(original);
+    current(data);
+    result = data->Image = sfImage_Copy(original);
+    optimized(data);
+    identical = (memcmp(sfImage_GetPixelsPtr(result), currentUsesImage ? sfImage_GetPixelsPtr(reference) : data->Pixels, size) == 0);
+
+    // Then time them, on the same copies
+    data->Image = reference;
+    currentTime = Measure(current, data);
+    data->Image = result;
+    optimizedTime = Measure(optimized, data);
+
+    data->Image = original;
+    sfImage_Destroy(result);
+    sfImage_Destroy(reference);
+
+    Report(name, currentTime, optimizedTime);
+    if (!identical)
+        printf("    results of both paths differ!\n");
+
+    return identical;
+}
+
+
+////////////////////////////////////////////////////////////
+static sfImage* CreateRandomImage(unsigned int width, unsigned int height, sfColor key)
+{
+    sfImage* image = sfImage_CreateFromColor(width, height, key);
+    sfUint8* pixels = sfImage_LockPixels(image);
+    size_t size = (size_t)width * height * 4;
+    size_t i;
+
+    // Leave one pixel out of 8 equal to the color key
+    for (i = 0; i < size; ++i)
+    {
+        if ((i / 4) % 8 != 0)
+            pixels[i] = (sfUint8)(rand() % 256);
+    }
+    sfImage_UnlockPixels(image);
+
+    return image;
+}
+
+
+////////////////////////////////////////////////////////////
+int main(int argc, char** argv)
+{
+    Data data;
+    int identical = 1;
+
+    // The size of the image can be given on the command line
+    data.Width  = (argc > 2) ? (unsigned int)atoi(argv[1]) : 3840;
+    data.Height = (argc > 2) ? (unsigned int)atoi(argv[2]) : 2160;
+    if ((data.Width == 0) || (data.Height == 0))
+    {
+        printf("Usage: %s [width height]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    data.Key = sfColor_FromRGBA(255, 0, 255, 255);
+    data.Color = sfColor_FromRGBA(40, 120, 200, 100);
+    data.Image = CreateRandomImage(data.Width, data.Height, data.Key);
+    data.Source = CreateRandomImage(data.Width, data.Height, data.Key);
+    data.Pixels = malloc((size_t)data.Width * data.Height * 4);
+
+    printf("Processing %ux%u images\n\n", data.Width, data.Height);
+    ReportHeader();
+
+    identical &= Compare(&data, "CreateMaskFromColor", MaskCurrent, MaskNew, sfFalse);
+    identical &= Compare(&data, "FlipHorizontally", FlipHorizontallyCurrent, FlipHorizontallyNew, sfFalse);
+    identical &= Compare(&data, "FlipVertically", FlipVerticallyCurrent, FlipVerticallyNew, sfFalse);
+    identical &= Compare(&data, "CopyImage (applyAlpha)", CopyCurrent, CopyNew, sfFalse);
+    identical &= Compare(&data, "PremultiplyAlpha", PremultiplyCurrent, PremultiplyNew, sfTrue);
+    identical &= Compare(&data, "SwizzleChannels", SwizzleCurrent, SwizzleNew, sfTrue);
+    identical &= Compare(&data, "FillRect", FillCurrent, FillNew, sfTrue);
+    identical &= Compare(&data, "BlendRect", BlendCurrent, BlendNew, sfTrue);
+
+    printf("\n%s\n", identical ? "Both paths give identical pixels" : "Some results differ between both paths");
+
+    free(data.Pixels);
+    sfImage_Destroy(data.Source);
+    sfImage_Destroy(data.Image);
+
+    return identical ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,175 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Compare transforming points and rectangles one by one
+// with sfTransform_TransformPoint / sfTransform_TransformRect,
+// and in a single call with sfTransform_TransformPoints /
+// sfTransform_TransformRects
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <Benchmark.h>
+#include <SFML/Graphics.h>
+#include <stdlib.h>
+#include <math.h>
+
+
+////////////////////////////////////////////////////////////
+// Data shared by the benchmarked functions
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfTransform* Transform;
+    size_t       Count;
+    float*       Points;
+    float*       TransformedPoints;
+    sfFloatRect* Rects;
+    sfFloatRect* TransformedRects;
+} Data;
+
+
+////////////////////////////////////////////////////////////
+static void UpdateError(float* error, float value, float expected)
+{
+    float difference = (float)fabs(value - expected);
+    if (difference > *error)
+        *error = difference;
+}
+
+
+////////////////////////////////////////////////////////////
+static void PointsOneByOne(void* userData)
+{
+    Data* data = (Data*)userData;
+    size_t i;
+
+    for (i = 0; i < data->Count; ++i)
+        sfTransform_TransformPoint(data->Transform, data->Points[i * 2], data->Points[i * 2 + 1],
+                                   &data->TransformedPoints[i * 2], &data->TransformedPoints[i * 2 + 1]);
+}
+
+
+////////////////////////////////////////////////////////////
+static void PointsBatch(void* userData)
+{
+    Data* data = (Data*)userData;
+
+    sfTransform_TransformPoints(data->Transform, data->Points, data->TransformedPoints, data->Count);
+}
+
+
+////////////////////////////////////////////////////////////
+static void RectsOneByOne(void* userData)
+{
+    Data* data = (Data*)userData;
+    size_t i;
+
+    for (i = 0; i < data->Count; ++i)
+        sfTransform_TransformRect(data->Transform, data->Rects[i], &data->TransformedRects[i]);
+}
+
+
+////////////////////////////////////////////////////////////
+static void RectsBatch(void* userData)
+{
+    Data* data = (Data*)userData;
+
+    sfTransform_TransformRects(data->Transform, data->Rects, data->TransformedRects, data->Count);
+}
+
+
+////////////////////////////////////////////////////////////
+int main(int argc, char** argv)
+{
+    Data data;
+    float* expectedPoints;
+    sfFloatRect* expectedRects;
+    double current, optimized;
+    float error = 0.f;
+    size_t i;
+
+    // The number of points can be given on the command line
+    data.Count = (argc > 1) ? (size_t)atol(argv[1]) : 200000;
+
+    data.Transform = sfTransform_Create();
+    sfTransform_Translate(data.Transform, 120.f, -35.f);
+    sfTransform_RotateWithCenter(data.Transform, 33.f, 400.f, 300.f);
+    sfTransform_Scale(data.Transform, 1.5f, 0.75f);
+
+    data.Points = malloc(data.Count * 2 * sizeof(float));
+    data.TransformedPoints = malloc(data.Count * 2 * sizeof(float));
+    data.Rects = malloc(data.Count * sizeof(sfFloatRect));
+    data.TransformedRects = malloc(data.Count * sizeof(sfFloatRect));
+    expectedPoints = malloc(data.Count * 2 * sizeof(float));
+    expectedRects = malloc(data.Count * sizeof(sfFloatRect));
+    for (i = 0; i < data.Count; ++i)
+    {
+        data.Points[i * 2]     = (float)(rand() % 8000) / 10.f;
+        data.Points[i * 2 + 1] = (float)(rand() % 6000) / 10.f;
+        data.Rects[i].Left     = data.Points[i * 2];
+        data.Rects[i].Top      = data.Points[i * 2 + 1];
+        data.Rects[i].Width    = (float)(rand() % 640) / 10.f;
+        data.Rects[i].Height   = (float)(rand() % 640) / 10.f;
+    }
+
+    printf("Transforming %u points and rectangles\n\n", (unsigned int)data.Count);
+    ReportHeader();
+
+    current = Measure(PointsOneByOne, &data);
+    for (i = 0; i < data.Count * 2; ++i)
+        expectedPoints[i] = data.TransformedPoints[i];
+    optimized = Measure(PointsBatch, &data);
+    for (i = 0; i < data.Count * 2; ++i)
+        UpdateError(&error, data.TransformedPoints[i], expectedPoints[i]);
+    Report("Points", current, optimized);
+
+    current = Measure(RectsOneByOne, &data);
+    for (i = 0; i < data.Count; ++i)
+        expectedRects[i] = data.TransformedRects[i];
+    optimized = Measure(RectsBatch, &data);
+    for (i = 0; i < data.Count; ++i)
+    {
+        UpdateError(&error, data.TransformedRects[i].Left, expectedRects[i].Left);
+        UpdateError(&error, data.TransformedRects[i].Top, expectedRects[i].Top);
+        UpdateError(&error, data.TransformedRects[i].Width, expectedRects[i].Width);
+        UpdateError(&error, data.TransformedRects[i].Height, expectedRects[i].Height);
+    }
+    Report("Rectangles", current, optimized);
+
+    printf("\nMaximum difference between both paths: %g\n", error);
+
+    free(expectedRects);
+    free(expectedPoints);
+    free(data.TransformedRects);
+    free(data.Rects);
+    free(data.TransformedPoints);
+    free(data.Points);
+    sfTransform_Destroy(data.Transform);
+
+    return EXIT_SUCCESS;
+}
@@ -104,3 +104,20 @@ macro(csfml_add_library target)
             ARCHIVE DESTINATION lib${LIB_SUFFIX} COMPONENT devel)
 
 endmacro()
+
+# add a new target which is a benchmark program (not installed)
+# ex: csfml_add_benchmark(csfml-benchmark-transform
+#                         SOURCES TransformBenchmark.c
+#                         DEPENDS csfml-graphics csfml-system)
+macro(csfml_add_benchmark target)
+
+    # parse the arguments
+    csfml_parse_arguments(THIS "SOURCES;DEPENDS" "" ${ARGN})
+
+    # create the target
+    add_executable(${target} ${THIS_SOURCES})
+
+    # link the target to its dependencies (CSFML libraries)
+    target_link_libraries(${target} ${THIS_DEPENDS})
+
+endmacro()
@@ -31,24 +31,34 @@
 
 #include <SFML/Window.h>
 #include <SFML/Graphics/BlendMode.h>
+#include <SFML/Graphics/CaptureTicket.h>
 #include <SFML/Graphics/CircleShape.h>
 #include <SFML/Graphics/Color.h>
 #include <SFML/Graphics/ConvexShape.h>
+#include <SFML/Graphics/DrawCommandList.h>
 #include <SFML/Graphics/Font.h>
+#include <SFML/Graphics/FrameRecorder.h>
 #include <SFML/Graphics/Glyph.h>
 #include <SFML/Graphics/Image.h>
 #include <SFML/Graphics/PrimitiveType.h>
 #include <SFML/Graphics/Rect.h>
 #include <SFML/Graphics/RectangleShape.h>
 #include <SFML/Graphics/RenderStates.h>
+#include <SFML/Graphics/RenderStatesObject.h>
 #include <SFML/Graphics/RenderWindow.h>
 #include <SFML/Graphics/RenderTexture.h>
 #include <SFML/Graphics/Shader.h>
 #include <SFML/Graphics/Shape.h>
+#include <SFML/Graphics/Sprite.h>
+#include <SFML/Graphics/SpriteBatch.h>
 #include <SFML/Graphics/Text.h>
+#include <SFML/Graphics/TextBatch.h>
 #include <SFML/Graphics/Texture.h>
+#include <SFML/Graphics/TextureAtlas.h>
+#include <SFML/Graphics/TextureLoader.h>
 #include <SFML/Graphics/Transform.h>
 #include <SFML/Graphics/Transformable.h>
+#include <SFML/Graphics/TransformablePool.h>
 #include <SFML/Graphics/Vertex.h>
 #include <SFML/Graphics/VertexArray.h>
 #include <SFML/Graphics/View.h>
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_CAPTURETICKET_H
+#define SFML_CAPTURETICKET_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/Types.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Tell whether the pixels of an asynchronous capture are available
+///
+/// A capture ticket is returned by sfRenderWindow_CaptureAsync,
+/// sfRenderTexture_CaptureAsync and sfTexture_CopyToImageAsync.
+/// The pixels are transferred by the graphics driver in the
+/// background, typically within one or two frames; this function
+/// never blocks, it can be polled every frame until it returns
+/// sfTrue. When the driver can't report the completion of the
+/// transfer, this function always returns sfTrue.
+///
+/// \param ticket Capture ticket object
+///
+/// \return sfTrue if sfCaptureTicket_GetImage won't block, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfBool sfCaptureTicket_IsReady(const sfCaptureTicket* ticket);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the captured pixels of an asynchronous capture, as a new image
+///
+/// If the transfer is not finished yet, this function waits
+/// until it is.
+///
+/// \param ticket Capture ticket object
+///
+/// \return New image containing the captured pixels
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfImage* sfCaptureTicket_GetImage(sfCaptureTicket* ticket);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing capture ticket
+///
+/// A ticket can be destroyed at any time, even if its
+/// transfer is not finished.
+///
+/// \param ticket Capture ticket to delete
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfCaptureTicket_Destroy(sfCaptureTicket* ticket);
+
+
+#endif // SFML_CAPTURETICKET_H
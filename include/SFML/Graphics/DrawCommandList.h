@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_DRAWCOMMANDLIST_H
+#define SFML_DRAWCOMMANDLIST_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/PrimitiveType.h>
+#include <SFML/Graphics/RenderStates.h>
+#include <SFML/Graphics/Types.h>
+#include <SFML/Graphics/Vertex.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new draw command list
+///
+/// A draw command list records draw calls together with
+/// their render states and a sort key, so that they can be
+/// sorted to minimize render state changes and replayed
+/// on any render window or render texture, as many times
+/// as needed.
+///
+/// Drawable objects are recorded by reference: they are not
+/// copied, so they must stay alive as long as the list
+/// references them, and replaying the list draws their
+/// current state. Primitives are copied into the list.
+///
+/// \return A new sfDrawCommandList object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfDrawCommandList* sfDrawCommandList_Create(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Copy an existing draw command list
+///
+/// \param list Draw command list to copy
+///
+/// \return Copied object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfDrawCommandList* sfDrawCommandList_Copy(sfDrawCommandList* list);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing draw command list
+///
+/// \param list Draw command list to delete
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfDrawCommandList_Destroy(sfDrawCommandList* list);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove all the commands of a draw command list
+///
+/// \param list Draw command list object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfDrawCommandList_Clear(sfDrawCommandList* list);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of commands recorded in a draw command list
+///
+/// \param list Draw command list object
+///
+/// \return Number of commands
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfDrawCommandList_GetCommandCount(const sfDrawCommandList* list);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the drawing of a drawable object
+///
+/// \param list    Draw command list object
+/// \param object  Object to draw
+/// \param states  Render states to use for drawing (NULL to use the default states)
+/// \param sortKey User sort key (commands with a lower key are drawn first after sorting)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfDrawCommandList_AddSprite(sfDrawCommandList* list, const sfSprite* object, const sfRenderStates* states, unsigned int sortKey);
+CSFML_GRAPHICS_API void sfDrawCommandList_AddText(sfDrawCommandList* list, const sfText* object, const sfRenderStates* states, unsigned int sortKey);
+CSFML_GRAPHICS_API void sfDrawCommandList_AddShape(sfDrawCommandList* list, const sfShape* object, const sfRenderStates* states, unsigned int sortKey);
+CSFML_GRAPHICS_API void sfDrawCommandList_AddCircleShape(sfDrawCommandList* list, const sfCircleShape* object, const sfRenderStates* states, unsigned int sortKey);
+CSFML_GRAPHICS_API void sfDrawCommandList_AddConvexShape(sfDrawCommandList* list, const sfConvexShape* object, const sfRenderStates* states, unsigned int sortKey);
+CSFML_GRAPHICS_API void sfDrawCommandList_AddRectangleShape(sfDrawCommandList* list, const sfRectangleShape* object, const sfRenderStates* states, unsigned int sortKey);
+CSFML_GRAPHICS_API void sfDrawCommandList_AddVertexArray(sfDrawCommandList* list, const sfVertexArray* object, const sfRenderStates* states, unsigned int sortKey);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the drawing of primitives defined by an array of vertices
+///
+/// The vertices are copied into the list.
+///
+/// \param list        Draw command list object
+/// \param vertices    Pointer to the vertices
+/// \param vertexCount Number of vertices in the array
+/// \param type        Type of primitives to draw
+/// \param states      Render states to use for drawing (NULL to use the default states)
+/// \param sortKey     User sort key (commands with a lower key are drawn first after sorting)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfDrawCommandList_AddPrimitives(sfDrawCommandList* list,
+                                                        const sfVertex* vertices, unsigned int vertexCount,
+                                                        sfPrimitiveType type, const sfRenderStates* states,
+                                                        unsigned int sortKey);
+
+////////////////////////////////////////////////////////////
+/// \brief Sort the commands of a draw command list
+///
+/// The commands are sorted by sort key first, then, among
+/// commands with the same key, by shader, texture and blend
+/// mode so that consecutive commands share the same states
+/// as much as possible. The sort is stable: commands that
+/// use exactly the same key and states keep their order.
+/// Use different keys for things that must be drawn in a
+/// specific order (like overlapping translucent objects).
+///
+/// The textures used by the recorded objects are read when
+/// the list is sorted, so if they change afterwards, the list
+/// should be sorted again to keep the draw calls grouped (the
+/// objects are always drawn with their current texture).
+///
+/// \param list Draw command list object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfDrawCommandList_Sort(sfDrawCommandList* list);
+
+
+#endif // SFML_DRAWCOMMANDLIST_H
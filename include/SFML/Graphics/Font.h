@@ -110,6 +110,38 @@ CSFML_GRAPHICS_API sfGlyph sfFont_GetGlyph(sfFont* font, sfUint32 codePoint, uns
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API int sfFont_GetKerning(sfFont* font, sfUint32 first, sfUint32 second, unsigned int characterSize);
 
+////////////////////////////////////////////////////////////
+/// \brief Get many glyphs of a font at once
+///
+/// This function is equivalent to calling sfFont_GetGlyph
+/// for every element of \a codePoints, but in a single call.
+///
+/// \param font          Source font
+/// \param codePoints    Array of unicode code points of the characters to get
+/// \param count         Number of elements in \a codePoints
+/// \param characterSize Character size, in pixels
+/// \param bold          Retrieve the bold version or the regular one?
+/// \param glyphs        Array of \a count glyphs to fill
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfFont_GetGlyphs(sfFont* font, const sfUint32* codePoints, size_t count, unsigned int characterSize, sfBool bold, sfGlyph* glyphs);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the kerning values of all the pairs of a set of characters
+///
+/// On return, \a table[i * count + j] contains the kerning
+/// offset between \a codePoints[i] (first character) and
+/// \a codePoints[j] (second character).
+///
+/// \param font          Source font
+/// \param codePoints    Array of unicode code points of the characters
+/// \param count         Number of elements in \a codePoints
+/// \param characterSize Character size, in pixels
+/// \param table         Array of \a count * \a count kerning offsets to fill, in pixels
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfFont_GetKerningTable(sfFont* font, const sfUint32* codePoints, size_t count, unsigned int characterSize, int* table);
+
 ////////////////////////////////////////////////////////////
 /// \brief Get the line spacing value
 ///
@@ -125,6 +157,11 @@ CSFML_GRAPHICS_API int sfFont_GetLineSpacing(sfFont* font, unsigned int characte
 ////////////////////////////////////////////////////////////
 /// \brief Get the texture containing the glyphs of a given size in a font
 ///
+/// The returned texture is not a copy: it is a view of the
+/// font's internal texture, so calling this function is cheap
+/// and the texture always reflects the glyphs loaded so far.
+/// The pointer stays valid as long as the font exists.
+///
 /// \param font          Source font
 /// \param characterSize Character size, in pixels
 ///
@@ -133,6 +170,47 @@ CSFML_GRAPHICS_API int sfFont_GetLineSpacing(sfFont* font, unsigned int characte
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API const sfTexture* sfFont_GetTexture(sfFont* font, unsigned int characterSize);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the generation counter of the texture containing the glyphs of a given size in a font
+///
+/// The font's texture grows when new glyphs no longer fit in it.
+/// The generation counter changes every time the texture size
+/// changes, so by comparing it with a previously returned value
+/// you can tell whether data that depends on the texture size
+/// (like normalized texture coordinates) must be recomputed.
+///
+/// \param font          Source font
+/// \param characterSize Character size, in pixels
+///
+/// \return Current generation of the texture
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfFont_GetTextureGeneration(sfFont* font, unsigned int characterSize);
+
+////////////////////////////////////////////////////////////
+/// \brief Load glyphs in advance, so that they are ready when they are first drawn
+///
+/// Every code point of every range is rasterized and added
+/// to the font's texture for every character size, so that
+/// drawing them later doesn't cause any glyph loading or
+/// texture growth. This is typically done on loading screens.
+/// Since the glyphs are uploaded to the font's textures, this
+/// function must be called from a thread with an active
+/// OpenGL context, like any other function that draws text.
+///
+/// \param font       Source font
+/// \param ranges     Array of inclusive code point ranges, as (first, last) pairs
+/// \param rangeCount Number of ranges (half the number of elements in \a ranges)
+/// \param sizes      Array of character sizes to load, in pixels
+/// \param sizeCount  Number of elements in \a sizes
+/// \param bold       Load the bold version of the glyphs
+///
+/// \return Total memory used by the textures of the given sizes, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfFont_PreloadGlyphs(sfFont* font, const sfUint32* ranges, size_t rangeCount,
+                                               const unsigned int* sizes, size_t sizeCount, sfBool bold);
+
 ////////////////////////////////////////////////////////////
 /// \brief Get the built-in default font (Arial)
 ///
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_FRAMERECORDER_H
+#define SFML_FRAMERECORDER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/Types.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief File formats that a frame recorder can write
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfFrameRecorderY4M,    ///< YUV4MPEG2 stream with 4:2:0 full range chroma, readable by most video tools
+    sfFrameRecorderRawRGBA ///< Raw 32-bits RGBA pixels, one frame after the other, without any header
+} sfFrameRecorderFormat;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new frame recorder writing to a file
+///
+/// A frame recorder streams frames to an uncompressed video
+/// file. The pixels are read back from the graphics card
+/// asynchronously, and they are converted and written to the
+/// file by a dedicated thread, so that recording doesn't
+/// stall the render loop. When more than \a maxQueuedFrames
+/// frames are waiting to be written, the new frames are
+/// dropped instead of blocking the caller.
+///
+/// \param filename         Path of the file to write
+/// \param width            Width of the frames, in pixels
+/// \param height           Height of the frames, in pixels
+/// \param frameRate        Number of frames per second, written in the file header
+/// \param format           Format of the file
+/// \param maxQueuedFrames  Maximum number of frames waiting to be written (at least 1)
+///
+/// \return A new sfFrameRecorder object, or NULL if the file couldn't be opened
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfFrameRecorder* sfFrameRecorder_Create(const char* filename, unsigned int width, unsigned int height, unsigned int frameRate, sfFrameRecorderFormat format, unsigned int maxQueuedFrames);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing frame recorder
+///
+/// All the queued frames are written before the file is
+/// closed, so this function may block until they are.
+///
+/// \param recorder Frame recorder to delete
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfFrameRecorder_Destroy(sfFrameRecorder* recorder);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the current contents of a render texture
+///
+/// The size of the render texture must be the same as
+/// the size of the recorder. This function should be called
+/// after sfRenderTexture_Display.
+///
+/// \param recorder      Frame recorder object
+/// \param renderTexture Render texture to capture
+///
+/// \return sfTrue if the frame was queued, sfFalse if it was dropped
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfBool sfFrameRecorder_AddFrame(sfFrameRecorder* recorder, sfRenderTexture* renderTexture);
+
+////////////////////////////////////////////////////////////
+/// \brief Record a frame from an array of pixels
+///
+/// The pixels are copied, they must be 32-bits RGBA and
+/// contain width * height pixels, top-to-bottom.
+///
+/// \param recorder Frame recorder object
+/// \param pixels   Array of pixels to record
+///
+/// \return sfTrue if the frame was queued, sfFalse if it was dropped
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfBool sfFrameRecorder_AddFramePixels(sfFrameRecorder* recorder, const sfUint8* pixels);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of frames queued since the recorder was created
+///
+/// \param recorder Frame recorder object
+///
+/// \return Number of frames accepted by the recorder
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfFrameRecorder_GetFrameCount(const sfFrameRecorder* recorder);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of frames dropped since the recorder was created
+///
+/// Frames are dropped when the writer thread can't keep up
+/// with the render loop, or when the file can't be written.
+///
+/// \param recorder Frame recorder object
+///
+/// \return Number of frames dropped by the recorder
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfFrameRecorder_GetDroppedFrameCount(const sfFrameRecorder* recorder);
+
+
+#endif // SFML_FRAMERECORDER_H
@@ -36,6 +36,18 @@
 #include <stddef.h>
 
 
+////////////////////////////////////////////////////////////
+/// \brief Filters available to resize images
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfImageFilterBox,      ///< Average of the covered pixels (nearest pixel when enlarging), fastest
+    sfImageFilterBilinear, ///< Linear interpolation, widened to the covered pixels when shrinking
+    sfImageFilterLanczos   ///< 3-lobed Lanczos windowed sinc, sharpest but slowest
+} sfImageFilter;
+
+
 ////////////////////////////////////////////////////////////
 /// \brief Create an image
 ///
@@ -124,6 +136,47 @@ CSFML_GRAPHICS_API sfImage* sfImage_CreateFromMemory(const void* data, size_t si
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfImage* sfImage_CreateFromStream(sfInputStream* stream);
 
+////////////////////////////////////////////////////////////
+/// \brief Create many images from files on disk, in parallel
+///
+/// The files are decoded by \a threadCount threads (the calling
+/// thread being one of them), and this function returns when
+/// all of them are done.
+/// On return, \a images[i] contains the image loaded from
+/// \a filenames[i], or NULL if it couldn't be loaded.
+/// The images must be destroyed with sfImage_Destroy.
+///
+/// \param filenames   Array of paths of the image files to load
+/// \param count       Number of files in \a filenames
+/// \param threadCount Number of threads to use (0 or 1 to load on the calling thread only)
+/// \param images      Array of \a count pointers to fill with the loaded images
+///
+/// \return Number of images successfully loaded
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfImage_CreateFromFilesBatch(const char* const* filenames, size_t count, unsigned int threadCount, sfImage** images);
+
+////////////////////////////////////////////////////////////
+/// \brief Create many images from files in memory, in parallel
+///
+/// The files are decoded by \a threadCount threads (the calling
+/// thread being one of them), and this function returns when
+/// all of them are done.
+/// On return, \a images[i] contains the image loaded from
+/// \a data[i], or NULL if it couldn't be loaded.
+/// The images must be destroyed with sfImage_Destroy.
+///
+/// \param data        Array of pointers to the file data in memory
+/// \param sizes       Array of sizes of the files, in bytes
+/// \param count       Number of files in \a data
+/// \param threadCount Number of threads to use (0 or 1 to load on the calling thread only)
+/// \param images      Array of \a count pointers to fill with the loaded images
+///
+/// \return Number of images successfully loaded
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfImage_CreateFromMemoryBatch(const void* const* data, const size_t* sizes, size_t count, unsigned int threadCount, sfImage** images);
+
 ////////////////////////////////////////////////////////////
 /// \brief Copy an existing image
 ///
@@ -190,7 +243,7 @@ CSFML_GRAPHICS_API unsigned int sfImage_GetHeight(const sfImage* image);
 /// \param alpha Alpha value to assign to transparent pixels
 ///
 ////////////////////////////////////////////////////////////
-CSFML_GRAPHICS_API void sfImage_CreateMaskFromColor(sfColor color, sfUint8 alpha);
+CSFML_GRAPHICS_API void sfImage_CreateMaskFromColor(sfImage* image, sfColor color, sfUint8 alpha);
 
 ////////////////////////////////////////////////////////////
 /// \brief Copy pixels from an image onto another
@@ -263,6 +316,71 @@ CSFML_GRAPHICS_API sfColor sfImage_GetPixel(const sfImage* image, unsigned int x
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API const sfUint8* sfImage_GetPixelsPtr(const sfImage* image);
 
+////////////////////////////////////////////////////////////
+/// \brief Get a writable pointer to the array of pixels of an image
+///
+/// The returned value points to the same array as
+/// sfImage_GetPixelsPtr, and can be used to modify the pixels
+/// directly, without copying them. It remains valid until
+/// sfImage_UnlockPixels is called. An image can only be locked
+/// once at a time: this function returns a null pointer if
+/// the image is already locked, or if it is empty.
+///
+/// \param image Image object
+///
+/// \return Writable pointer to the array of pixels
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfUint8* sfImage_LockPixels(sfImage* image);
+
+////////////////////////////////////////////////////////////
+/// \brief Release the pointer returned by sfImage_LockPixels
+///
+/// \param image Image object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfImage_UnlockPixels(sfImage* image);
+
+////////////////////////////////////////////////////////////
+/// \brief Copy a rectangle of pixels of an image to an array
+///
+/// The rows of the rectangle are written \a stride bytes
+/// apart in \a pixels; a stride of 0 means that they are
+/// tightly packed (rect.Width * 4 bytes). If \a rect is empty,
+/// the whole image is read. The rectangle must be entirely
+/// inside the image.
+///
+/// \param image  Image object
+/// \param rect   Rectangle to read
+/// \param pixels Array receiving the 32-bits RGBA pixels
+/// \param stride Number of bytes between the beginnings of two rows in \a pixels
+///
+/// \return sfTrue on success, sfFalse if the rectangle is not inside the image
+///         or if \a stride is not 0 and smaller than rect.Width * 4
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfBool sfImage_ReadPixels(const sfImage* image, sfIntRect rect, sfUint8* pixels, size_t stride);
+
+////////////////////////////////////////////////////////////
+/// \brief Copy an array of pixels to a rectangle of an image
+///
+/// The rows of the rectangle are read \a stride bytes
+/// apart in \a pixels; a stride of 0 means that they are
+/// tightly packed (rect.Width * 4 bytes). If \a rect is empty,
+/// the whole image is written. The rectangle must be entirely
+/// inside the image.
+///
+/// \param image  Image object
+/// \param rect   Rectangle to write
+/// \param pixels Array of 32-bits RGBA pixels to copy
+/// \param stride Number of bytes between the beginnings of two rows in \a pixels
+///
+/// \return sfTrue on success, sfFalse if the rectangle is not inside the image
+///         or if \a stride is not 0 and smaller than rect.Width * 4
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfBool sfImage_WritePixels(sfImage* image, sfIntRect rect, const sfUint8* pixels, size_t stride);
+
 ////////////////////////////////////////////////////////////
 /// \brief Flip an image horizontally (left <-> right)
 ///
@@ -279,5 +397,105 @@ CSFML_GRAPHICS_API void sfImage_FlipHorizontally(sfImage* image);
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfImage_FlipVertically(sfImage* image);
 
+////////////////////////////////////////////////////////////
+/// \brief Multiply the color components of every pixel by its alpha
+///
+/// Premultiplied pixels can be drawn with a (One, OneMinusSrcAlpha)
+/// blending and filtered without dark fringes around the
+/// transparent areas. The alpha components are not changed.
+///
+/// \param image Image object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfImage_PremultiplyAlpha(sfImage* image);
+
+////////////////////////////////////////////////////////////
+/// \brief Reorder the components of every pixel of an image
+///
+/// Each parameter is the index (0 for red, 1 for green, 2 for
+/// blue, 3 for alpha) of the component that is moved to the
+/// corresponding position. For example, (2, 1, 0, 3) converts
+/// the pixels from RGBA to BGRA. If an index is greater than 3,
+/// the image is left unchanged.
+///
+/// \param image Image object
+/// \param red   Index of the component to put in red
+/// \param green Index of the component to put in green
+/// \param blue  Index of the component to put in blue
+/// \param alpha Index of the component to put in alpha
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfImage_SwizzleChannels(sfImage* image, unsigned int red, unsigned int green, unsigned int blue, unsigned int alpha);
+
+////////////////////////////////////////////////////////////
+/// \brief Set all the pixels of a rectangle of an image to a color
+///
+/// If \a rect is empty, the whole image is filled. The parts
+/// of the rectangle outside the image are ignored.
+///
+/// \param image Image object
+/// \param rect  Rectangle to fill
+/// \param color Color to write
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfImage_FillRect(sfImage* image, sfIntRect rect, sfColor color);
+
+////////////////////////////////////////////////////////////
+/// \brief Blend a color over a rectangle of an image
+///
+/// The color is blended with its alpha like the source pixels
+/// of sfImage_CopyImage when \a applyAlpha is sfTrue.
+/// If \a rect is empty, the whole image is blended. The parts
+/// of the rectangle outside the image are ignored.
+///
+/// \param image Image object
+/// \param rect  Rectangle to blend
+/// \param color Color to blend over the pixels
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfImage_BlendRect(sfImage* image, sfIntRect rect, sfColor color);
+
+////////////////////////////////////////////////////////////
+/// \brief Create a resized copy of an image
+///
+/// The image is resampled on the CPU, so this function doesn't
+/// need an OpenGL context. The four components of the pixels
+/// are filtered independently; premultiply the alpha first
+/// (see sfImage_PremultiplyAlpha) to avoid color fringes around
+/// transparent areas.
+/// Large images are split across \a threadCount threads
+/// (the calling thread being one of them).
+///
+/// \param image       Image object
+/// \param width       Width of the new image
+/// \param height      Height of the new image
+/// \param filter      Filter to use
+/// \param threadCount Maximum number of threads to use (at least 1)
+///
+/// \return A new sfImage object, or NULL if the image or the new size is empty
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfImage* sfImage_Resize(const sfImage* image, unsigned int width, unsigned int height, sfImageFilter filter, unsigned int threadCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Generate the successive mipmap levels of an image
+///
+/// Each level is half the size of the previous one (rounded
+/// down, and never less than 1), starting with half the size
+/// of \a image and down to 1x1. Each level is resampled from
+/// the previous one with sfImage_Resize.
+/// A full chain has floor(log2(max(width, height))) levels.
+///
+/// \param image       Image object
+/// \param filter      Filter to use
+/// \param threadCount Maximum number of threads to use (at least 1)
+/// \param levels      Array receiving the new images, from the largest to the smallest
+/// \param maxLevels   Maximum number of levels to generate (size of the \a levels array)
+///
+/// \return Number of levels written to \a levels
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API size_t sfImage_GenerateMipChain(const sfImage* image, sfImageFilter filter, unsigned int threadCount, sfImage** levels, size_t maxLevels);
+
 
 #endif // SFML_IMAGE_H
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_RENDERSTATESOBJECT_H
+#define SFML_RENDERSTATESOBJECT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/RenderStates.h>
+#include <SFML/Graphics/Types.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new render states object
+///
+/// A render states object holds render states already converted
+/// to their internal representation, so that drawing with it
+/// (see the sfRenderWindow_Draw*WithStateObject and
+/// sfRenderTexture_Draw*WithStateObject functions) costs nothing
+/// more than drawing with the default states.
+/// The transform is copied, but the texture and shader are
+/// referenced: they must exist as long as the object uses them.
+///
+/// \param states Render states to convert (NULL to use the default states)
+///
+/// \return A new sfRenderStatesObject object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfRenderStatesObject* sfRenderStatesObject_Create(const sfRenderStates* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Copy an existing render states object
+///
+/// \param states Render states object to copy
+///
+/// \return Copied object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfRenderStatesObject* sfRenderStatesObject_Copy(sfRenderStatesObject* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing render states object
+///
+/// \param states Render states object to delete
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderStatesObject_Destroy(sfRenderStatesObject* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Replace the render states held by a render states object
+///
+/// \param states    Render states object
+/// \param newStates New render states (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderStatesObject_Update(sfRenderStatesObject* states, const sfRenderStates* newStates);
+
+////////////////////////////////////////////////////////////
+/// \brief Change the transform of a render states object
+///
+/// The other states are left unchanged.
+///
+/// \param states    Render states object
+/// \param transform New transform (NULL to use the identity transform)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderStatesObject_SetTransform(sfRenderStatesObject* states, const sfTransform* transform);
+
+
+#endif // SFML_RENDERSTATESOBJECT_H
@@ -34,6 +34,7 @@
 #include <SFML/Graphics/Types.h>
 #include <SFML/Graphics/PrimitiveType.h>
 #include <SFML/Graphics/RenderStates.h>
+#include <SFML/Graphics/RenderStatesObject.h>
 #include <SFML/Graphics/Vertex.h>
 
 
@@ -188,6 +189,79 @@ CSFML_GRAPHICS_API void sfRenderTexture_DrawPrimitives(sfRenderTexture* renderTe
                                               const sfVertex* vertices, unsigned int vertexCount,
                                               sfPrimitiveType type, const sfRenderStates* states);
 
+////////////////////////////////////////////////////////////
+/// \brief Draw all the sprites accumulated in a sprite batch to a render texture
+///
+/// The sprites are drawn in the order they were added, with
+/// one draw call per group of consecutive sprites sharing
+/// the same texture, blend mode and shader.
+///
+/// \param renderTexture Render texture object
+/// \param batch         Sprite batch to draw
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexture_DrawSpriteBatch(sfRenderTexture* renderTexture, const sfSpriteBatch* batch);
+
+////////////////////////////////////////////////////////////
+/// \brief Replay all the commands of a draw command list on a render texture
+///
+/// The commands are drawn in their current order: call
+/// sfDrawCommandList_Sort first to group them by render states.
+///
+/// \param renderTexture Render texture object
+/// \param list          Draw command list to draw
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexture_DrawCommandList(sfRenderTexture* renderTexture, const sfDrawCommandList* list);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw all the strings of a text batch to a render texture
+///
+/// The strings are drawn with one draw call per font and
+/// character size. The texture of the render states is
+/// ignored, the glyph texture of each font is used instead.
+///
+/// \param renderTexture Render texture object
+/// \param batch         Text batch to draw
+/// \param states        Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexture_DrawTextBatch(sfRenderTexture* renderTexture, const sfTextBatch* batch, const sfRenderStates* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw a drawable object to the render-target, with precompiled render states
+///
+/// These functions are equivalent to their sfRenderTexture_Draw*
+/// counterparts, but take the render states as a sfRenderStatesObject
+/// so that they don't have to be converted on every call.
+///
+/// \param renderTexture Render texture object
+/// \param object        Object to draw
+/// \param states        Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexture_DrawSpriteWithStateObject(sfRenderTexture* renderTexture, const sfSprite* object, const sfRenderStatesObject* states);
+CSFML_GRAPHICS_API void sfRenderTexture_DrawTextWithStateObject(sfRenderTexture* renderTexture, const sfText* object, const sfRenderStatesObject* states);
+CSFML_GRAPHICS_API void sfRenderTexture_DrawShapeWithStateObject(sfRenderTexture* renderTexture, const sfShape* object, const sfRenderStatesObject* states);
+CSFML_GRAPHICS_API void sfRenderTexture_DrawCircleShapeWithStateObject(sfRenderTexture* renderTexture, const sfCircleShape* object, const sfRenderStatesObject* states);
+CSFML_GRAPHICS_API void sfRenderTexture_DrawConvexShapeWithStateObject(sfRenderTexture* renderTexture, const sfConvexShape* object, const sfRenderStatesObject* states);
+CSFML_GRAPHICS_API void sfRenderTexture_DrawRectangleShapeWithStateObject(sfRenderTexture* renderTexture, const sfRectangleShape* object, const sfRenderStatesObject* states);
+CSFML_GRAPHICS_API void sfRenderTexture_DrawVertexArrayWithStateObject(sfRenderTexture* renderTexture, const sfVertexArray* object, const sfRenderStatesObject* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw primitives defined by an array of vertices to a render texture, with precompiled render states
+///
+/// \param renderTexture Render texture object
+/// \param vertices      Pointer to the vertices
+/// \param vertexCount   Number of vertices in the array
+/// \param type          Type of primitives to draw
+/// \param states        Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderTexture_DrawPrimitivesWithStateObject(sfRenderTexture* renderTexture,
+                                                                      const sfVertex* vertices, unsigned int vertexCount,
+                                                                      sfPrimitiveType type, const sfRenderStatesObject* states);
+
 ////////////////////////////////////////////////////////////
 /// \brief Save the current OpenGL render states and matrices
 ///
@@ -246,6 +320,21 @@ CSFML_GRAPHICS_API void sfRenderTexture_ResetGLStates(sfRenderTexture* renderTex
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API const sfTexture* sfRenderTexture_GetTexture(const sfRenderTexture* renderTexture);
 
+////////////////////////////////////////////////////////////
+/// \brief Start copying the current contents of a render texture to an image, without waiting
+///
+/// The pixels are transferred in the background, and can be
+/// collected one or two frames later with sfCaptureTicket_GetImage,
+/// without stalling the rendering.
+/// The returned ticket must be destroyed with sfCaptureTicket_Destroy.
+///
+/// \param renderTexture Render texture object
+///
+/// \return New capture ticket, or NULL if the render texture couldn't be activated
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfCaptureTicket* sfRenderTexture_CaptureAsync(sfRenderTexture* renderTexture);
+
 ////////////////////////////////////////////////////////////
 /// \brief Enable or disable the smooth filter on a render texture
 ///
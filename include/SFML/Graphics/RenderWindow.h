@@ -34,6 +34,7 @@
 #include <SFML/Graphics/Types.h>
 #include <SFML/Graphics/PrimitiveType.h>
 #include <SFML/Graphics/RenderStates.h>
+#include <SFML/Graphics/RenderStatesObject.h>
 #include <SFML/Graphics/Vertex.h>
 #include <SFML/Window/Event.h>
 #include <SFML/Window/VideoMode.h>
@@ -356,6 +357,79 @@ CSFML_GRAPHICS_API void sfRenderWindow_DrawPrimitives(sfRenderWindow* renderWind
                                              const sfVertex* vertices, unsigned int vertexCount,
                                              sfPrimitiveType type, const sfRenderStates* states);
 
+////////////////////////////////////////////////////////////
+/// \brief Draw all the sprites accumulated in a sprite batch to a render window
+///
+/// The sprites are drawn in the order they were added, with
+/// one draw call per group of consecutive sprites sharing
+/// the same texture, blend mode and shader.
+///
+/// \param renderWindow render window object
+/// \param batch        Sprite batch to draw
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderWindow_DrawSpriteBatch(sfRenderWindow* renderWindow, const sfSpriteBatch* batch);
+
+////////////////////////////////////////////////////////////
+/// \brief Replay all the commands of a draw command list on a render window
+///
+/// The commands are drawn in their current order: call
+/// sfDrawCommandList_Sort first to group them by render states.
+///
+/// \param renderWindow render window object
+/// \param list         Draw command list to draw
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderWindow_DrawCommandList(sfRenderWindow* renderWindow, const sfDrawCommandList* list);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw all the strings of a text batch to a render window
+///
+/// The strings are drawn with one draw call per font and
+/// character size. The texture of the render states is
+/// ignored, the glyph texture of each font is used instead.
+///
+/// \param renderWindow render window object
+/// \param batch        Text batch to draw
+/// \param states       Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderWindow_DrawTextBatch(sfRenderWindow* renderWindow, const sfTextBatch* batch, const sfRenderStates* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw a drawable object to the render-target, with precompiled render states
+///
+/// These functions are equivalent to their sfRenderWindow_Draw*
+/// counterparts, but take the render states as a sfRenderStatesObject
+/// so that they don't have to be converted on every call.
+///
+/// \param renderWindow render window object
+/// \param object       Object to draw
+/// \param states       Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderWindow_DrawSpriteWithStateObject(sfRenderWindow* renderWindow, const sfSprite* object, const sfRenderStatesObject* states);
+CSFML_GRAPHICS_API void sfRenderWindow_DrawTextWithStateObject(sfRenderWindow* renderWindow, const sfText* object, const sfRenderStatesObject* states);
+CSFML_GRAPHICS_API void sfRenderWindow_DrawShapeWithStateObject(sfRenderWindow* renderWindow, const sfShape* object, const sfRenderStatesObject* states);
+CSFML_GRAPHICS_API void sfRenderWindow_DrawCircleShapeWithStateObject(sfRenderWindow* renderWindow, const sfCircleShape* object, const sfRenderStatesObject* states);
+CSFML_GRAPHICS_API void sfRenderWindow_DrawConvexShapeWithStateObject(sfRenderWindow* renderWindow, const sfConvexShape* object, const sfRenderStatesObject* states);
+CSFML_GRAPHICS_API void sfRenderWindow_DrawRectangleShapeWithStateObject(sfRenderWindow* renderWindow, const sfRectangleShape* object, const sfRenderStatesObject* states);
+CSFML_GRAPHICS_API void sfRenderWindow_DrawVertexArrayWithStateObject(sfRenderWindow* renderWindow, const sfVertexArray* object, const sfRenderStatesObject* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw primitives defined by an array of vertices to a render window, with precompiled render states
+///
+/// \param renderWindow render window object
+/// \param vertices     Pointer to the vertices
+/// \param vertexCount  Number of vertices in the array
+/// \param type         Type of primitives to draw
+/// \param states       Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfRenderWindow_DrawPrimitivesWithStateObject(sfRenderWindow* renderWindow,
+                                                                     const sfVertex* vertices, unsigned int vertexCount,
+                                                                     sfPrimitiveType type, const sfRenderStatesObject* states);
+
 ////////////////////////////////////////////////////////////
 /// \brief Save the current OpenGL render states and matrices
 ///
@@ -422,5 +496,23 @@ CSFML_GRAPHICS_API void sfRenderWindow_ResetGLStates(sfRenderWindow* renderWindo
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfImage* sfRenderWindow_Capture(const sfRenderWindow* renderWindow);
 
+////////////////////////////////////////////////////////////
+/// \brief Start copying the current contents of a render window to an image, without waiting
+///
+/// This function is the asynchronous version of
+/// sfRenderWindow_Capture: the pixels are transferred in
+/// the background, and can be collected one or two frames
+/// later with sfCaptureTicket_GetImage, without stalling
+/// the rendering. Like sfRenderWindow_Capture, it must be
+/// called before sfRenderWindow_Display.
+/// The returned ticket must be destroyed with sfCaptureTicket_Destroy.
+///
+/// \param renderWindow Render window object
+///
+/// \return New capture ticket, or NULL if the window couldn't be activated
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfCaptureTicket* sfRenderWindow_CaptureAsync(const sfRenderWindow* renderWindow);
+
 
 #endif // SFML_RENDERWINDOW_H
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SPRITEBATCH_H
+#define SFML_SPRITEBATCH_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/RenderStates.h>
+#include <SFML/Graphics/Types.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new sprite batch
+///
+/// A sprite batch accumulates the geometry of many sprites
+/// into a single vertex stream, so that they can be drawn
+/// with one draw call per texture / render states combination
+/// instead of one draw call per sprite.
+///
+/// \return A new sfSpriteBatch object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfSpriteBatch* sfSpriteBatch_Create(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Copy an existing sprite batch
+///
+/// \param batch Sprite batch to copy
+///
+/// \return Copied object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfSpriteBatch* sfSpriteBatch_Copy(sfSpriteBatch* batch);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing sprite batch
+///
+/// \param batch Sprite batch to delete
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfSpriteBatch_Destroy(sfSpriteBatch* batch);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove all the sprites from a sprite batch
+///
+/// The memory allocated for the vertices is kept, so that
+/// refilling the batch every frame doesn't reallocate.
+///
+/// \param batch Sprite batch object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfSpriteBatch_Clear(sfSpriteBatch* batch);
+
+////////////////////////////////////////////////////////////
+/// \brief Add a sprite to a sprite batch
+///
+/// The sprite's geometry is computed immediately (with its
+/// current transform, texture rect and color), so modifying
+/// or destroying the sprite afterwards doesn't affect the batch.
+/// The transform of \a states is applied on the CPU; its
+/// texture is ignored (the sprite's own texture is used).
+/// A new draw call is started whenever the texture, blend
+/// mode or shader differs from the previous sprite.
+/// Sprites without a texture are ignored, as they are not
+/// drawn when drawn directly.
+///
+/// \param batch  Sprite batch object
+/// \param sprite Sprite to add
+/// \param states Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfSpriteBatch_AddSprite(sfSpriteBatch* batch, const sfSprite* sprite, const sfRenderStates* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Add an array of sprites to a sprite batch
+///
+/// This function is equivalent to calling sfSpriteBatch_AddSprite
+/// for each sprite of the array, with the same render states.
+///
+/// \param batch       Sprite batch object
+/// \param sprites     Pointer to the array of sprites to add
+/// \param spriteCount Number of sprites in the array
+/// \param states      Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfSpriteBatch_AddSprites(sfSpriteBatch* batch, const sfSprite* const* sprites, size_t spriteCount, const sfRenderStates* states);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of sprites contained in a sprite batch
+///
+/// \param batch Sprite batch object
+///
+/// \return Number of sprites
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfSpriteBatch_GetSpriteCount(const sfSpriteBatch* batch);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of draw calls needed to draw a sprite batch
+///
+/// This is the number of times the texture, blend mode
+/// or shader changes between consecutive sprites, plus one.
+///
+/// \param batch Sprite batch object
+///
+/// \return Number of draw calls
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfSpriteBatch_GetDrawCallCount(const sfSpriteBatch* batch);
+
+
+#endif // SFML_SPRITEBATCH_H
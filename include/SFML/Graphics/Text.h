@@ -251,6 +251,18 @@ CSFML_GRAPHICS_API void sfText_SetString(sfText* text, const char* string);
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfText_SetUnicodeString(sfText* text, const sfUint32* string);
 
+////////////////////////////////////////////////////////////
+/// \brief Set the string of a text (from an UTF-8 string)
+///
+/// If the new string is the same as the current one, the
+/// text is left untouched and its geometry is not rebuilt.
+///
+/// \param text   Text object
+/// \param string New string, as a null-terminated UTF-8 string
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfText_SetUtf8String(sfText* text, const char* string);
+
 ////////////////////////////////////////////////////////////
 /// \brief Set the font of a text
 ///
@@ -324,6 +336,21 @@ CSFML_GRAPHICS_API const char* sfText_GetString(const sfText* text);
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API const sfUint32* sfText_GetUnicodeString(const sfText* text);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the string of a text (returns an UTF-8 string)
+///
+/// The conversion is cached: it is done again only after
+/// the string of the text has changed.
+/// The returned pointer is valid until the next change of
+/// the text's string.
+///
+/// \param text Text object
+///
+/// \return String as a null-terminated UTF-8 string
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API const char* sfText_GetUtf8String(const sfText* text);
+
 ////////////////////////////////////////////////////////////
 /// \brief Get the font used by a text
 ///
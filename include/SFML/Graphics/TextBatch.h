@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TEXTBATCH_H
+#define SFML_TEXTBATCH_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/Color.h>
+#include <SFML/Graphics/Types.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new text batch
+///
+/// A text batch lays out many strings into shared vertex
+/// buffers, one per font and character size, so that
+/// thousands of small labels can be drawn with a few draw
+/// calls instead of one sfText (and one draw call) each.
+/// The layout is the same as sfText's.
+///
+/// \return A new sfTextBatch object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTextBatch* sfTextBatch_Create(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Copy an existing text batch
+///
+/// \param batch Text batch to copy
+///
+/// \return Copied object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTextBatch* sfTextBatch_Copy(sfTextBatch* batch);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing text batch
+///
+/// \param batch Text batch to delete
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTextBatch_Destroy(sfTextBatch* batch);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove all the strings from a text batch
+///
+/// The allocated memory is kept, so that filling the batch
+/// again every frame doesn't allocate.
+///
+/// \param batch Text batch object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTextBatch_Clear(sfTextBatch* batch);
+
+////////////////////////////////////////////////////////////
+/// \brief Add a string to a text batch (from an UTF-8 string)
+///
+/// The fonts used by a batch must stay alive as long as
+/// the batch contains strings that use them.
+///
+/// \param batch         Text batch object
+/// \param string        String to add, as a null-terminated UTF-8 string
+/// \param font          Font to use (NULL to use the default font)
+/// \param characterSize Character size, in pixels
+/// \param style         Style of the text (combination of sfTextStyle values)
+/// \param x             X coordinate of the top-left corner of the string
+/// \param y             Y coordinate of the top-left corner of the string
+/// \param color         Color of the string
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTextBatch_AddString(sfTextBatch* batch, const char* string, const sfFont* font, unsigned int characterSize,
+                                              sfUint32 style, float x, float y, sfColor color);
+
+////////////////////////////////////////////////////////////
+/// \brief Add a string to a text batch (from a unicode string)
+///
+/// The fonts used by a batch must stay alive as long as
+/// the batch contains strings that use them.
+///
+/// \param batch         Text batch object
+/// \param string        String to add, as a null-terminated UTF-32 string
+/// \param font          Font to use (NULL to use the default font)
+/// \param characterSize Character size, in pixels
+/// \param style         Style of the text (combination of sfTextStyle values)
+/// \param x             X coordinate of the top-left corner of the string
+/// \param y             Y coordinate of the top-left corner of the string
+/// \param color         Color of the string
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTextBatch_AddUnicodeString(sfTextBatch* batch, const sfUint32* string, const sfFont* font, unsigned int characterSize,
+                                                     sfUint32 style, float x, float y, sfColor color);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of draw calls needed to draw a text batch
+///
+/// This is the number of distinct font / character size
+/// combinations used by the strings of the batch.
+///
+/// \param batch Text batch object
+///
+/// \return Number of draw calls
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfTextBatch_GetDrawCallCount(const sfTextBatch* batch);
+
+
+#endif // SFML_TEXTBATCH_H
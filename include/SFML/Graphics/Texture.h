@@ -140,6 +140,23 @@ CSFML_GRAPHICS_API unsigned int sfTexture_GetHeight(const sfTexture* texture);
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfImage* sfTexture_CopyToImage(const sfTexture* texture);
 
+////////////////////////////////////////////////////////////
+/// \brief Start copying a texture's pixels to an image, without waiting
+///
+/// This function is the asynchronous version of
+/// sfTexture_CopyToImage: the pixels are transferred in
+/// the background, and can be collected one or two frames
+/// later with sfCaptureTicket_GetImage, without stalling
+/// the rendering.
+/// The returned ticket must be destroyed with sfCaptureTicket_Destroy.
+///
+/// \param texture Texture to copy
+///
+/// \return New capture ticket
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfCaptureTicket* sfTexture_CopyToImageAsync(const sfTexture* texture);
+
 ////////////////////////////////////////////////////////////
 /// \brief Update a texture from an array of pixels
 ///
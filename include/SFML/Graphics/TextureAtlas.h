@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TEXTUREATLAS_H
+#define SFML_TEXTUREATLAS_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/Rect.h>
+#include <SFML/Graphics/Types.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new texture atlas
+///
+/// A texture atlas packs many small images into one or more
+/// large textures (pages), so that sprites using them can
+/// share the same texture and be batched together.
+/// Pages start with the given size and grow when they are
+/// full, up to sfTexture_GetMaximumSize; when the last page
+/// can't grow anymore, a new page is created.
+/// The atlas keeps a copy of the pixels of every image, so
+/// that pages can be grown or repacked without the source
+/// images.
+///
+/// \param width   Initial width of the pages, in pixels
+/// \param height  Initial height of the pages, in pixels
+/// \param padding Number of empty pixels to leave between images
+///
+/// \return A new sfTextureAtlas object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTextureAtlas* sfTextureAtlas_Create(unsigned int width, unsigned int height, unsigned int padding);
+
+////////////////////////////////////////////////////////////
+/// \brief Copy an existing texture atlas
+///
+/// \param atlas Texture atlas to copy
+///
+/// \return Copied object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTextureAtlas* sfTextureAtlas_Copy(sfTextureAtlas* atlas);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing texture atlas
+///
+/// \param atlas Texture atlas to delete
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTextureAtlas_Destroy(sfTextureAtlas* atlas);
+
+////////////////////////////////////////////////////////////
+/// \brief Add an image to a texture atlas
+///
+/// \param atlas Texture atlas object
+/// \param image Image to add
+///
+/// \return Identifier of the new entry, or -1 if the image doesn't fit in a texture or the texture can't be created
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API int sfTextureAtlas_AddImage(sfTextureAtlas* atlas, const sfImage* image);
+
+////////////////////////////////////////////////////////////
+/// \brief Add an array of pixels to a texture atlas
+///
+/// The \a pixels array is assumed to contain 32-bits RGBA pixels,
+/// and have the given \a width and \a height.
+///
+/// \param atlas  Texture atlas object
+/// \param pixels Array of pixels to add
+/// \param width  Width of the pixel region
+/// \param height Height of the pixel region
+///
+/// \return Identifier of the new entry, or -1 if the pixels don't fit in a texture or the texture can't be created
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API int sfTextureAtlas_AddPixels(sfTextureAtlas* atlas, const sfUint8* pixels, unsigned int width, unsigned int height);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove an entry from a texture atlas
+///
+/// The identifier of the entry becomes invalid, but the
+/// identifiers of the other entries don't change.
+/// The space used by the entry in its page is reclaimed
+/// only when the atlas is repacked.
+///
+/// \param atlas Texture atlas object
+/// \param id    Identifier of the entry to remove
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTextureAtlas_Remove(sfTextureAtlas* atlas, int id);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the area of an entry in its page
+///
+/// The returned rectangle can be passed directly to
+/// sfSprite_SetTextureRect, together with the texture
+/// returned by sfTextureAtlas_GetTexture.
+///
+/// \param atlas Texture atlas object
+/// \param id    Identifier of the entry
+///
+/// \return Area of the entry in its page texture
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfIntRect sfTextureAtlas_GetTextureRect(const sfTextureAtlas* atlas, int id);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the index of the page that contains an entry
+///
+/// \param atlas Texture atlas object
+/// \param id    Identifier of the entry
+///
+/// \return Index of the page containing the entry
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfTextureAtlas_GetPage(const sfTextureAtlas* atlas, int id);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of pages of a texture atlas
+///
+/// \param atlas Texture atlas object
+///
+/// \return Number of pages
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfTextureAtlas_GetPageCount(const sfTextureAtlas* atlas);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the texture of a page of a texture atlas
+///
+/// The returned texture is owned by the atlas and must not
+/// be destroyed. It stays valid until the atlas is destroyed,
+/// or until the page is removed by sfTextureAtlas_Repack.
+///
+/// \param atlas Texture atlas object
+/// \param page  Index of the page
+///
+/// \return Texture of the page, or NULL if \a page is out of range
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API const sfTexture* sfTextureAtlas_GetTexture(const sfTextureAtlas* atlas, unsigned int page);
+
+////////////////////////////////////////////////////////////
+/// \brief Repack all the entries of a texture atlas
+///
+/// The entries are sorted by size and packed again into
+/// the smallest possible number of pages, reclaiming the
+/// space of removed entries, and the pages are uploaded
+/// again from the pixels stored in the atlas.
+/// After this call, the texture rectangle and the page of
+/// every entry may have changed, and the pages that are no
+/// longer needed are destroyed.
+///
+/// \param atlas Texture atlas object
+///
+/// \return sfTrue if all the entries could be packed and uploaded, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfBool sfTextureAtlas_Repack(sfTextureAtlas* atlas);
+
+
+#endif // SFML_TEXTUREATLAS_H
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TEXTURELOADER_H
+#define SFML_TEXTURELOADER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/Rect.h>
+#include <SFML/Graphics/Types.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Status of an asynchronous texture load request
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfTextureLoadPending, ///< The image is waiting for a worker or being decoded
+    sfTextureLoadReady,   ///< The image is decoded, the texture can be retrieved
+    sfTextureLoadFailed,  ///< The image couldn't be decoded
+    sfTextureLoadInvalid  ///< Unknown request (never issued, cancelled or already retrieved)
+} sfTextureLoadStatus;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new asynchronous texture loader
+///
+/// A texture loader decodes images on a pool of worker
+/// threads, so that loading textures doesn't block the
+/// rendering thread. Only the final upload to the graphics
+/// card is done on the calling thread, when the texture
+/// is retrieved with sfTextureLoader_GetTexture.
+///
+/// \param threadCount Number of worker threads (at least 1)
+/// \param maxRequests Maximum number of requests that can be in progress at the same time (0 for no limit)
+///
+/// \return A new sfTextureLoader object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTextureLoader* sfTextureLoader_Create(unsigned int threadCount, unsigned int maxRequests);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing texture loader
+///
+/// All the pending requests are cancelled, and this function
+/// waits for the images being decoded to be finished.
+///
+/// \param loader Texture loader to delete
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTextureLoader_Destroy(sfTextureLoader* loader);
+
+////////////////////////////////////////////////////////////
+/// \brief Request the asynchronous loading of a texture from a file
+///
+/// The \a area argument can be used to load only a sub-rectangle
+/// of the whole image. If you want the entire image then leave
+/// it NULL.
+///
+/// \param loader   Texture loader object
+/// \param filename Path of the image file to load
+/// \param area     Area of the source image to load (NULL to load the entire image)
+///
+/// \return Identifier of the request, or 0 if the maximum number of requests is reached
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfTextureLoader_LoadFromFile(sfTextureLoader* loader, const char* filename, const sfIntRect* area);
+
+////////////////////////////////////////////////////////////
+/// \brief Request the asynchronous loading of a texture from a file in memory
+///
+/// The data is copied, so it can be freed as soon as this
+/// function returns.
+///
+/// \param loader      Texture loader object
+/// \param data        Pointer to the file data in memory
+/// \param sizeInBytes Size of the data to load, in bytes
+/// \param area        Area of the source image to load (NULL to load the entire image)
+///
+/// \return Identifier of the request, or 0 if the maximum number of requests is reached
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfTextureLoader_LoadFromMemory(sfTextureLoader* loader, const void* data, size_t sizeInBytes, const sfIntRect* area);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the status of a request
+///
+/// This function doesn't block, it is meant to be
+/// polled by the rendering thread.
+///
+/// \param loader Texture loader object
+/// \param id     Identifier of the request
+///
+/// \return Current status of the request
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTextureLoadStatus sfTextureLoader_GetStatus(const sfTextureLoader* loader, unsigned int id);
+
+////////////////////////////////////////////////////////////
+/// \brief Retrieve the texture of a finished request
+///
+/// If the image of the request is decoded, the texture is
+/// created from it on the calling thread (which must have an
+/// active OpenGL context, like any other texture creation),
+/// and the request is released.
+/// If the request failed, it is released and NULL is returned.
+/// If the request is still pending, NULL is returned and the
+/// request is kept.
+/// The returned texture must be destroyed with sfTexture_Destroy.
+///
+/// \param loader Texture loader object
+/// \param id     Identifier of the request
+///
+/// \return A new sfTexture object, or NULL if it isn't available
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTexture* sfTextureLoader_GetTexture(sfTextureLoader* loader, unsigned int id);
+
+////////////////////////////////////////////////////////////
+/// \brief Cancel a request
+///
+/// If the image is not being decoded yet, it is simply removed
+/// from the queue; otherwise its result is discarded as soon
+/// as the worker is done with it. In both cases, the identifier
+/// of the request becomes invalid immediately.
+///
+/// \param loader Texture loader object
+/// \param id     Identifier of the request to cancel
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTextureLoader_Cancel(sfTextureLoader* loader, unsigned int id);
+
+////////////////////////////////////////////////////////////
+/// \brief Cancel all the requests of a texture loader
+///
+/// \param loader Texture loader object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTextureLoader_CancelAll(sfTextureLoader* loader);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of requests in progress
+///
+/// This includes the requests that are waiting for a worker,
+/// being decoded, and those which are finished but whose
+/// texture was not retrieved yet.
+///
+/// \param loader Texture loader object
+///
+/// \return Number of requests in progress
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfTextureLoader_GetRequestCount(const sfTextureLoader* loader);
+
+
+#endif // SFML_TEXTURELOADER_H
@@ -31,6 +31,7 @@
 #include <SFML/Graphics/Export.h>
 #include <SFML/Graphics/Rect.h>
 #include <SFML/Graphics/Types.h>
+#include <stddef.h>
 
 
 ////////////////////////////////////////////////////////////
@@ -140,6 +141,39 @@ CSFML_GRAPHICS_API void sfTransform_TransformPoint(const sfTransform* transform,
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfTransform_TransformRect(const sfTransform* transform, sfFloatRect rectangle, sfFloatRect* transformedRectangle);
 
+////////////////////////////////////////////////////////////
+/// \brief Apply a transform to an array of 2D points
+///
+/// The points are stored as consecutive (x, y) pairs, so
+/// \a points and \a transformedPoints must both contain
+/// 2 * \a pointCount floats. Both arrays can be the same,
+/// to transform the points in place.
+/// This function is much faster than calling
+/// sfTransform_TransformPoint for each point, since it uses
+/// the SIMD instructions of the processor when available.
+///
+/// \param transform         Transform object
+/// \param points            Points to transform
+/// \param transformedPoints Array to fill with the transformed points
+/// \param pointCount        Number of points to transform
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransform_TransformPoints(const sfTransform* transform, const float* points, float* transformedPoints, size_t pointCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Apply a transform to an array of rectangles
+///
+/// Each rectangle is transformed like with sfTransform_TransformRect.
+/// Both arrays can be the same, to transform the rectangles in place.
+///
+/// \param transform             Transform object
+/// \param rectangles            Rectangles to transform
+/// \param transformedRectangles Array to fill with the transformed rectangles
+/// \param rectangleCount        Number of rectangles to transform
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransform_TransformRects(const sfTransform* transform, const sfFloatRect* rectangles, sfFloatRect* transformedRectangles, size_t rectangleCount);
+
 ////////////////////////////////////////////////////////////
 /// \brief Combine two transforms
 ///
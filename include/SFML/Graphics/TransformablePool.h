@@ -0,0 +1,307 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TRANSFORMABLEPOOL_H
+#define SFML_TRANSFORMABLEPOOL_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Export.h>
+#include <SFML/Graphics/Types.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new transformable pool
+///
+/// A transformable pool stores the position, rotation, scale
+/// and origin of many objects in contiguous arrays (one array
+/// per component), and computes all their transforms in a
+/// single pass with sfTransformablePool_UpdateTransforms.
+/// Objects are identified by their index in the pool.
+/// New objects have the same default values as a sfTransformable:
+/// position (0, 0), rotation 0, scale (1, 1), origin (0, 0).
+///
+/// \param count Initial number of objects in the pool
+///
+/// \return A new sfTransformablePool object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTransformablePool* sfTransformablePool_Create(unsigned int count);
+
+////////////////////////////////////////////////////////////
+/// \brief Copy an existing transformable pool
+///
+/// \param pool Transformable pool to copy
+///
+/// \return Copied object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfTransformablePool* sfTransformablePool_Copy(sfTransformablePool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing transformable pool
+///
+/// \param pool Transformable pool to delete
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_Destroy(sfTransformablePool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Change the number of objects in a transformable pool
+///
+/// If \a count is greater than the current count, new objects
+/// with default values are added at the end of the pool.
+/// If \a count is less than the current count, the last
+/// objects are removed.
+///
+/// \param pool  Transformable pool object
+/// \param count New number of objects
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_Resize(sfTransformablePool* pool, unsigned int count);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of objects in a transformable pool
+///
+/// \param pool Transformable pool object
+///
+/// \return Number of objects
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfTransformablePool_GetCount(const sfTransformablePool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Add a new object at the end of a transformable pool
+///
+/// \param pool Transformable pool object
+///
+/// \return Index of the new object
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfTransformablePool_Add(sfTransformablePool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove an object from a transformable pool
+///
+/// To keep the arrays contiguous, the last object of the pool
+/// is moved to \a index (unless the removed object is the last one).
+/// Any index referring to the last object must therefore be
+/// updated to \a index.
+///
+/// \param pool  Transformable pool object
+/// \param index Index of the object to remove
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_Remove(sfTransformablePool* pool, unsigned int index);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the position of an object of a transformable pool
+///
+/// The functions that access a single object don't check
+/// \a index, it must be in range [0, count - 1]. The behaviour
+/// is undefined otherwise.
+///
+/// \param pool  Transformable pool object
+/// \param index Index of the object
+/// \param x     X coordinate of the new position
+/// \param y     Y coordinate of the new position
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_SetPosition(sfTransformablePool* pool, unsigned int index, float x, float y);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the orientation of an object of a transformable pool
+///
+/// \param pool  Transformable pool object
+/// \param index Index of the object
+/// \param angle New rotation, in degrees
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_SetRotation(sfTransformablePool* pool, unsigned int index, float angle);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the scale factors of an object of a transformable pool
+///
+/// \param pool    Transformable pool object
+/// \param index   Index of the object
+/// \param factorX New horizontal scale factor
+/// \param factorY New vertical scale factor
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_SetScale(sfTransformablePool* pool, unsigned int index, float factorX, float factorY);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the local origin of an object of a transformable pool
+///
+/// \param pool  Transformable pool object
+/// \param index Index of the object
+/// \param x     X coordinate of the new origin
+/// \param y     Y coordinate of the new origin
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_SetOrigin(sfTransformablePool* pool, unsigned int index, float x, float y);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the position of an object of a transformable pool
+///
+/// \param pool  Transformable pool object
+/// \param index Index of the object
+/// \param x     Receives the X coordinate of the position
+/// \param y     Receives the Y coordinate of the position
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_GetPosition(const sfTransformablePool* pool, unsigned int index, float* x, float* y);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the orientation of an object of a transformable pool
+///
+/// The rotation is always in the range [0, 360].
+///
+/// \param pool  Transformable pool object
+/// \param index Index of the object
+///
+/// \return Current rotation, in degrees
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API float sfTransformablePool_GetRotation(const sfTransformablePool* pool, unsigned int index);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the scale factors of an object of a transformable pool
+///
+/// \param pool  Transformable pool object
+/// \param index Index of the object
+/// \param x     Receives the horizontal scale factor
+/// \param y     Receives the vertical scale factor
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_GetScale(const sfTransformablePool* pool, unsigned int index, float* x, float* y);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the local origin of an object of a transformable pool
+///
+/// \param pool  Transformable pool object
+/// \param index Index of the object
+/// \param x     Receives the X coordinate of the origin
+/// \param y     Receives the Y coordinate of the origin
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_GetOrigin(const sfTransformablePool* pool, unsigned int index, float* x, float* y);
+
+////////////////////////////////////////////////////////////
+/// \brief Move an object of a transformable pool by a given offset
+///
+/// \param pool    Transformable pool object
+/// \param index   Index of the object
+/// \param offsetX X offset
+/// \param offsetY Y offset
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_Move(sfTransformablePool* pool, unsigned int index, float offsetX, float offsetY);
+
+////////////////////////////////////////////////////////////
+/// \brief Rotate an object of a transformable pool
+///
+/// \param pool  Transformable pool object
+/// \param index Index of the object
+/// \param angle Angle of rotation, in degrees
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_Rotate(sfTransformablePool* pool, unsigned int index, float angle);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the positions of a range of objects of a transformable pool
+///
+/// \a positions contains consecutive (x, y) pairs, one per
+/// object, starting with the object at index \a first.
+/// The range [first, first + count - 1] must be valid.
+///
+/// \param pool      Transformable pool object
+/// \param first     Index of the first object to modify
+/// \param positions Array of 2 * \a count floats
+/// \param count     Number of objects to modify
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_SetPositions(sfTransformablePool* pool, unsigned int first, const float* positions, unsigned int count);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the orientations of a range of objects of a transformable pool
+///
+/// The range [first, first + count - 1] must be valid.
+///
+/// \param pool   Transformable pool object
+/// \param first  Index of the first object to modify
+/// \param angles Array of \a count rotations, in degrees
+/// \param count  Number of objects to modify
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_SetRotations(sfTransformablePool* pool, unsigned int first, const float* angles, unsigned int count);
+
+////////////////////////////////////////////////////////////
+/// \brief Recompute the transforms of all the modified objects of a transformable pool
+///
+/// Only the objects that were modified since the last update
+/// are recomputed. The result can be read with
+/// sfTransformablePool_GetMatrices or sfTransformablePool_GetTransform.
+///
+/// \param pool Transformable pool object
+///
+/// \return Number of objects whose transform was recomputed
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API unsigned int sfTransformablePool_UpdateTransforms(sfTransformablePool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the transforms of all the objects of a transformable pool
+///
+/// The array contains one 3x3 matrix per object, stored as
+/// 9 consecutive floats in row-major order (the same order as
+/// the parameters of sfTransform_CreateFromMatrix).
+/// The matrices are only up to date after a call to
+/// sfTransformablePool_UpdateTransforms. The pointer is
+/// invalidated when objects are added or removed.
+///
+/// \param pool Transformable pool object
+///
+/// \return Pointer to the first matrix, or NULL if the pool is empty
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API const float* sfTransformablePool_GetMatrices(const sfTransformablePool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Copy the transform of an object of a transformable pool to a sfTransform
+///
+/// The transform is only up to date after a call to
+/// sfTransformablePool_UpdateTransforms.
+///
+/// \param pool   Transformable pool object
+/// \param index  Index of the object
+/// \param result Transform object to overwrite
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfTransformablePool_GetTransform(const sfTransformablePool* pool, unsigned int index, sfTransform* result);
+
+
+#endif // SFML_TRANSFORMABLEPOOL_H
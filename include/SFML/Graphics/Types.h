@@ -26,20 +26,29 @@
 #define SFML_GRAPHICS_TYPES_H
 
 
+typedef struct sfCaptureTicket sfCaptureTicket;
 typedef struct sfCircleShape sfCircleShape;
 typedef struct sfConvexShape sfConvexShape;
+typedef struct sfDrawCommandList sfDrawCommandList;
 typedef struct sfFont sfFont;
+typedef struct sfFrameRecorder sfFrameRecorder;
 typedef struct sfImage sfImage;
 typedef struct sfShader sfShader;
 typedef struct sfRectangleShape sfRectangleShape;
+typedef struct sfRenderStatesObject sfRenderStatesObject;
 typedef struct sfRenderTexture sfRenderTexture;
 typedef struct sfRenderWindow sfRenderWindow;
 typedef struct sfShape sfShape;
 typedef struct sfSprite sfSprite;
+typedef struct sfSpriteBatch sfSpriteBatch;
 typedef struct sfText sfText;
+typedef struct sfTextBatch sfTextBatch;
 typedef struct sfTexture sfTexture;
+typedef struct sfTextureAtlas sfTextureAtlas;
+typedef struct sfTextureLoader sfTextureLoader;
 typedef struct sfTransform sfTransform;
 typedef struct sfTransformable sfTransformable;
+typedef struct sfTransformablePool sfTransformablePool;
 typedef struct sfVertexArray sfVertexArray;
 typedef struct sfView sfView;
 
@@ -51,7 +51,7 @@ CSFML_GRAPHICS_API sfVertexArray* sfVertexArray_Create(void);
 /// \return Copied object
 ///
 ////////////////////////////////////////////////////////////
-CSFML_GRAPHICS_API sfVertexArray* sfTransform_Copy(sfVertexArray* vertexArray);
+CSFML_GRAPHICS_API sfVertexArray* sfVertexArray_Copy(sfVertexArray* vertexArray);
 
 ////////////////////////////////////////////////////////////
 /// \brief Destroy an existing vertex array
@@ -86,6 +86,22 @@ CSFML_GRAPHICS_API unsigned int sfVertexArray_GetVertexCount(const sfVertexArray
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API sfVertex* sfVertexArray_GetVertex(sfVertexArray* vertexArray, unsigned int index);
 
+////////////////////////////////////////////////////////////
+/// \brief Get direct access to all the vertices of a vertex array
+///
+/// The vertices are stored contiguously, so the returned pointer
+/// can be used to read or write the whole range
+/// [0, vertex count - 1] at once (with memcpy for example).
+/// The pointer is invalidated by any function that changes
+/// the number of vertices of the array.
+///
+/// \param vertexArray Vertex array object
+///
+/// \return Pointer to the first vertex, or NULL if the array is empty
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API sfVertex* sfVertexArray_GetVertices(sfVertexArray* vertexArray);
+
 ////////////////////////////////////////////////////////////
 /// \brief Clear a vertex array
 ///
@@ -114,6 +130,19 @@ CSFML_GRAPHICS_API void sfVertexArray_Clear(sfVertexArray* vertexArray);
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfVertexArray_Resize(sfVertexArray* vertexArray, unsigned int vertexCount);
 
+////////////////////////////////////////////////////////////
+/// \brief Allocate memory for a given number of vertices
+///
+/// This function doesn't change the vertex count of the array,
+/// it only makes sure that the array can grow up to \a vertexCount
+/// vertices without reallocating its memory.
+///
+/// \param vertexArray Vertex array object
+/// \param vertexCount Number of vertices to allocate memory for
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfVertexArray_Reserve(sfVertexArray* vertexArray, unsigned int vertexCount);
+
 ////////////////////////////////////////////////////////////
 /// \brief Add a vertex to a vertex array array
 ///
@@ -123,6 +152,48 @@ CSFML_GRAPHICS_API void sfVertexArray_Resize(sfVertexArray* vertexArray, unsigne
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfVertexArray_Append(sfVertexArray* vertexArray, sfVertex vertex);
 
+////////////////////////////////////////////////////////////
+/// \brief Add an array of vertices to the end of a vertex array
+///
+/// \param vertexArray Vertex array object
+/// \param vertices    Pointer to the vertices to add
+/// \param vertexCount Number of vertices to add
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfVertexArray_AppendVertices(sfVertexArray* vertexArray, const sfVertex* vertices, unsigned int vertexCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Insert an array of vertices into a vertex array
+///
+/// The vertices previously located at \a index and after
+/// are moved after the inserted ones.
+/// If \a index is greater than the vertex count, the vertices
+/// are added at the end of the array.
+///
+/// \param vertexArray Vertex array object
+/// \param index       Index where to insert the vertices
+/// \param vertices    Pointer to the vertices to insert
+/// \param vertexCount Number of vertices to insert
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfVertexArray_InsertVertices(sfVertexArray* vertexArray, unsigned int index, const sfVertex* vertices, unsigned int vertexCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Overwrite a range of vertices of a vertex array
+///
+/// The vertices in range [index, index + vertexCount - 1] are
+/// replaced with the given ones. If this range goes past the
+/// end of the array, the array is resized accordingly.
+/// Nothing is written if index + vertexCount overflows.
+///
+/// \param vertexArray Vertex array object
+/// \param index       Index of the first vertex to overwrite
+/// \param vertices    Pointer to the new vertices
+/// \param vertexCount Number of vertices to write
+///
+////////////////////////////////////////////////////////////
+CSFML_GRAPHICS_API void sfVertexArray_SetVertices(sfVertexArray* vertexArray, unsigned int index, const sfVertex* vertices, unsigned int vertexCount);
+
 ////////////////////////////////////////////////////////////
 /// \brief Set the type of primitives of a vertex array
 ///
@@ -32,6 +32,7 @@
 #include <SFML/System.h>
 #include <SFML/Network/IpAddress.h>
 #include <SFML/Network/Packet.h>
+#include <SFML/Network/PacketPool.h>
 #include <SFML/Network/SocketSelector.h>
 #include <SFML/Network/TcpListener.h>
 #include <SFML/Network/TcpSocket.h>
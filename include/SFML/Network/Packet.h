@@ -51,6 +51,23 @@ CSFML_NETWORK_API sfPacket* sfPacket_Create(void);
 ////////////////////////////////////////////////////////////
 CSFML_NETWORK_API sfPacket* sfPacket_Copy(sfPacket* packet);
 
+////////////////////////////////////////////////////////////
+/// \brief Create a new packet which reads its data directly
+///        from a block of memory
+///
+/// The data is not copied: it must remain valid and unchanged
+/// until the packet is destroyed, cleared or modified.
+/// Modifying the packet (appending or writing data) first
+/// makes it copy the data, and leaves the memory untouched.
+///
+/// \param data        Pointer to the data
+/// \param sizeInBytes Size of the data, in bytes
+///
+/// \return A new sfPacket object
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfPacket* sfPacket_CreateView(const void* data, size_t sizeInBytes);
+
 ////////////////////////////////////////////////////////////
 /// \brief Destroy a packet
 ///
@@ -79,6 +96,20 @@ CSFML_NETWORK_API void sfPacket_Append(sfPacket* packet, const void* data, size_
 ///////////////////////////////////////////////////////////
 CSFML_NETWORK_API void sfPacket_Clear(sfPacket* packet);
 
+////////////////////////////////////////////////////////////
+/// \brief Reserve storage in a packet for a given amount of data
+///
+/// This function doesn't change the contents of the packet,
+/// it only avoids reallocations while data is added, up to
+/// \a sizeInBytes bytes. The storage is kept when the
+/// packet is cleared.
+///
+/// \param packet      Packet object
+/// \param sizeInBytes Total size of data to reserve, in bytes
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_Reserve(sfPacket* packet, size_t sizeInBytes);
+
 ////////////////////////////////////////////////////////////
 /// \brief Get a pointer to the data contained in a packet
 ///
@@ -155,6 +186,28 @@ CSFML_NETWORK_API double   sfPacket_ReadDouble(sfPacket* packet);
 CSFML_NETWORK_API void     sfPacket_ReadString(sfPacket* packet, char* string);
 CSFML_NETWORK_API void     sfPacket_ReadWideString(sfPacket* packet, wchar_t* string);
 
+////////////////////////////////////////////////////////////
+/// \brief Functions to extract arrays of values from a packet
+///
+/// The values are read at once, in the same format as the
+/// functions that read a single value. If the packet doesn't
+/// contain enough data, nothing is read and the packet
+/// becomes invalid (see sfPacket_CanRead).
+///
+/// \param packet Packet object
+/// \param values Array to fill
+/// \param count  Number of values to read
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_ReadInt8Array(sfPacket* packet, sfInt8* values, size_t count);
+CSFML_NETWORK_API void sfPacket_ReadUint8Array(sfPacket* packet, sfUint8* values, size_t count);
+CSFML_NETWORK_API void sfPacket_ReadInt16Array(sfPacket* packet, sfInt16* values, size_t count);
+CSFML_NETWORK_API void sfPacket_ReadUint16Array(sfPacket* packet, sfUint16* values, size_t count);
+CSFML_NETWORK_API void sfPacket_ReadInt32Array(sfPacket* packet, sfInt32* values, size_t count);
+CSFML_NETWORK_API void sfPacket_ReadUint32Array(sfPacket* packet, sfUint32* values, size_t count);
+CSFML_NETWORK_API void sfPacket_ReadFloatArray(sfPacket* packet, float* values, size_t count);
+CSFML_NETWORK_API void sfPacket_ReadDoubleArray(sfPacket* packet, double* values, size_t count);
+
 ////////////////////////////////////////////////////////////
 /// \brief Functions to insert data into a packet
 ///
@@ -173,5 +226,25 @@ CSFML_NETWORK_API void sfPacket_WriteDouble(sfPacket* packet, double);
 CSFML_NETWORK_API void sfPacket_WriteString(sfPacket* packet, const char* string);
 CSFML_NETWORK_API void sfPacket_WriteWideString(sfPacket* packet, const wchar_t* string);
 
+////////////////////////////////////////////////////////////
+/// \brief Functions to insert arrays of values into a packet
+///
+/// The values are written at once, in the same format as the
+/// functions that write a single value.
+///
+/// \param packet Packet object
+/// \param values Array of values to write
+/// \param count  Number of values to write
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacket_WriteInt8Array(sfPacket* packet, const sfInt8* values, size_t count);
+CSFML_NETWORK_API void sfPacket_WriteUint8Array(sfPacket* packet, const sfUint8* values, size_t count);
+CSFML_NETWORK_API void sfPacket_WriteInt16Array(sfPacket* packet, const sfInt16* values, size_t count);
+CSFML_NETWORK_API void sfPacket_WriteUint16Array(sfPacket* packet, const sfUint16* values, size_t count);
+CSFML_NETWORK_API void sfPacket_WriteInt32Array(sfPacket* packet, const sfInt32* values, size_t count);
+CSFML_NETWORK_API void sfPacket_WriteUint32Array(sfPacket* packet, const sfUint32* values, size_t count);
+CSFML_NETWORK_API void sfPacket_WriteFloatArray(sfPacket* packet, const float* values, size_t count);
+CSFML_NETWORK_API void sfPacket_WriteDoubleArray(sfPacket* packet, const double* values, size_t count);
+
 
 #endif // SFML_PACKET_H
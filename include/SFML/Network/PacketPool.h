@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_PACKETPOOL_H
+#define SFML_PACKETPOOL_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/Export.h>
+#include <SFML/Network/Types.h>
+#include <stddef.h>
+
+
+////////////////////////////////////////////////////////////
+/// \brief Usage statistics of a packet pool
+///
+/// Packets are exchanged between the shared list of the pool
+/// and the caches of the threads in small batches; packets
+/// waiting in a thread cache are neither available nor
+/// outstanding.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    size_t Created;         ///< Total number of packets created by the pool
+    size_t Available;       ///< Number of packets waiting in the shared list of the pool
+    size_t Outstanding;     ///< Number of packets acquired and not released yet
+    size_t PeakOutstanding; ///< Highest value reached by Outstanding
+    size_t PeakDataSize;    ///< Largest data size of the packets given back to the pool, in bytes
+} sfPacketPoolStats;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new packet pool
+///
+/// A packet pool recycles packets, so that sending many
+/// messages doesn't allocate and free a packet and its
+/// storage for each one.
+///
+/// Besides the shared list, each of the first 16 threads that
+/// use the pool gets a cache of up to 32 packets, which is
+/// kept until the pool is destroyed; the other threads use
+/// the shared list directly.
+///
+/// \param packetCapacity Size of data to reserve in new packets, in bytes (see sfPacket_Reserve)
+/// \param maxPackets     Maximum number of packets kept in the shared list of the pool (0 for no limit)
+///
+/// \return A new sfPacketPool object
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfPacketPool* sfPacketPool_Create(size_t packetCapacity, size_t maxPackets);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a packet pool
+///
+/// The packets waiting in the pool, including the ones in
+/// the caches of all the threads, are destroyed. The packets
+/// still in use are not: they must be destroyed with
+/// sfPacket_Destroy.
+///
+/// \param pool Packet pool to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacketPool_Destroy(sfPacketPool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Take an empty packet from a pool
+///
+/// The packet is taken from the cache of the calling thread
+/// when possible, which doesn't need any lock; a new packet
+/// is created if the pool is empty.
+/// The packet should be given back with sfPacketPool_Release
+/// once it is no longer needed.
+///
+/// \param pool Packet pool object
+///
+/// \return An empty packet, which keeps the storage allocated by its previous uses
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfPacket* sfPacketPool_Acquire(sfPacketPool* pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Give a packet back to a pool
+///
+/// The packet is cleared and put in the cache of the calling
+/// thread, which doesn't have to be the thread that acquired
+/// it. It must not be used after this call.
+/// Any packet can be given to the pool, not only the ones
+/// that it created.
+///
+/// \param pool   Packet pool object
+/// \param packet Packet to give back
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API void sfPacketPool_Release(sfPacketPool* pool, sfPacket* packet);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the usage statistics of a packet pool
+///
+/// Outstanding and PeakOutstanding are updated on every call
+/// to sfPacketPool_Acquire and sfPacketPool_Release; PeakDataSize
+/// is only updated when packets are exchanged between the
+/// thread caches and the shared list of the pool.
+///
+/// \param pool Packet pool object
+///
+/// \return Current statistics of the pool
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfPacketPoolStats sfPacketPool_GetStats(const sfPacketPool* pool);
+
+
+#endif // SFML_PACKETPOOL_H
@@ -30,6 +30,7 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Export.h>
 #include <SFML/Network/IpAddress.h>
+#include <SFML/Network/SocketBuffer.h>
 #include <SFML/Network/SocketStatus.h>
 #include <SFML/Network/Types.h>
 #include <SFML/System/Time.h>
@@ -105,6 +106,21 @@ CSFML_NETWORK_API unsigned short sfTcpSocket_GetLocalPort(const sfTcpSocket* soc
 ////////////////////////////////////////////////////////////
 CSFML_NETWORK_API sfIpAddress sfTcpSocket_GetRemoteAddress(const sfTcpSocket* socket);
 
+////////////////////////////////////////////////////////////
+/// \brief Get the integer address of the connected peer of a TCP socket
+///
+/// This function is equivalent to sfTcpSocket_GetRemoteAddress,
+/// but the address is returned as its integer representation
+/// (see sfIpAddress_FromInteger), so that no string is formatted.
+/// If the socket is not connected, this function returns 0.
+///
+/// \param socket TCP socket object
+///
+/// \return Integer address of the remote peer
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfUint32 sfTcpSocket_GetRemoteAddressInteger(const sfTcpSocket* socket);
+
 ////////////////////////////////////////////////////////////
 /// \brief Get the port of the connected peer to which
 ///        a TCP socket is connected
@@ -136,6 +152,23 @@ CSFML_NETWORK_API unsigned short sfTcpSocket_GetRemotePort(const sfTcpSocket* so
 ////////////////////////////////////////////////////////////
 CSFML_NETWORK_API sfSocketStatus sfTcpSocket_Connect(sfTcpSocket* socket, sfIpAddress host, unsigned short port, sfTime timeout);
 
+////////////////////////////////////////////////////////////
+/// \brief Connect a TCP socket to a remote peer given by an integer address
+///
+/// This function is equivalent to sfTcpSocket_Connect, but the
+/// address is given as its integer representation (see
+/// sfIpAddress_ToInteger), so that no string has to be parsed.
+///
+/// \param socket  TCP socket object
+/// \param address Integer address of the remote peer
+/// \param port    Port of the remote peer
+/// \param timeout Maximum time to wait
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfTcpSocket_ConnectTo(sfTcpSocket* socket, sfUint32 address, unsigned short port, sfTime timeout);
+
 ////////////////////////////////////////////////////////////
 /// \brief Disconnect a TCP socket from its remote peer
 ///
@@ -161,6 +194,23 @@ CSFML_NETWORK_API void sfTcpSocket_Disconnect(sfTcpSocket* socket);
 ////////////////////////////////////////////////////////////
 CSFML_NETWORK_API sfSocketStatus sfTcpSocket_Send(sfTcpSocket* socket, const char* data, size_t size);
 
+////////////////////////////////////////////////////////////
+/// \brief Send several segments of data to the remote peer of a TCP socket
+///
+/// The segments are sent one after the other, as if they were
+/// a single contiguous block, with gathered writes: there's
+/// no copy and no separate system call for each segment.
+/// This function will fail if the socket is not connected.
+///
+/// \param socket  TCP socket object
+/// \param buffers Array of segments to send
+/// \param count   Number of segments in the array
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfTcpSocket_SendV(sfTcpSocket* socket, const sfSocketBuffer* buffers, size_t count);
+
 ////////////////////////////////////////////////////////////
 /// \brief Receive raw data from the remote peer of a TCP socket
 ///
@@ -33,6 +33,7 @@ typedef struct sfFtp sfFtp;
 typedef struct sfHttpRequest sfHttpRequest;
 typedef struct sfHttpResponse sfHttpResponse;
 typedef struct sfHttp sfHttp;
+typedef struct sfPacketPool sfPacketPool;
 typedef struct sfPacket sfPacket;
 typedef struct sfSocketSelector sfSocketSelector;
 typedef struct sfTcpListener sfTcpListener;
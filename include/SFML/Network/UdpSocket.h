@@ -30,11 +30,27 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Export.h>
 #include <SFML/Network/IpAddress.h>
+#include <SFML/Network/SocketBuffer.h>
 #include <SFML/Network/SocketStatus.h>
 #include <SFML/Network/Types.h>
 #include <stddef.h>
 
 
+////////////////////////////////////////////////////////////
+/// \brief Datagram sent or received by the batch functions of UDP sockets
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    char*          Data;      ///< Bytes to send, or buffer to fill with the received bytes
+    size_t         Size;      ///< Number of bytes to send, or number of bytes received
+    size_t         MaxSize;   ///< Size of the buffer pointed to by Data (ignored when sending)
+    sfUint32       Address;   ///< Integer address of the receiver or of the sender (see sfIpAddress_ToInteger)
+    unsigned short Port;      ///< Port of the receiver or of the sender
+    sfBool         Truncated; ///< Was the received datagram larger than MaxSize, and cut? (ignored when sending)
+} sfUdpDatagram;
+
+
 ////////////////////////////////////////////////////////////
 /// \brief Create a new UDP socket
 ///
@@ -195,6 +211,134 @@ CSFML_NETWORK_API sfSocketStatus sfUdpSocket_SendPacket(sfUdpSocket* socket, sfP
 ////////////////////////////////////////////////////////////
 CSFML_NETWORK_API sfSocketStatus sfUdpSocket_ReceivePacket(sfUdpSocket* socket, sfPacket* packet, sfIpAddress* address, unsigned short* port);
 
+////////////////////////////////////////////////////////////
+/// \brief Send raw data to a remote peer given by an integer address
+///
+/// This function is equivalent to sfUdpSocket_Send, but the
+/// address is given as its integer representation (see
+/// sfIpAddress_ToInteger), so that no string has to be parsed.
+///
+/// \param socket  UDP socket object
+/// \param data    Pointer to the sequence of bytes to send
+/// \param size    Number of bytes to send
+/// \param address Integer address of the receiver
+/// \param port    Port of the receiver to send the data to
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpSocket_SendTo(sfUdpSocket* socket, const char* data, size_t size, sfUint32 address, unsigned short port);
+
+////////////////////////////////////////////////////////////
+/// \brief Receive raw data and the integer address of its sender
+///
+/// This function is equivalent to sfUdpSocket_Receive, but the
+/// address of the sender is returned as its integer representation
+/// (see sfIpAddress_FromInteger), so that no string is formatted.
+///
+/// \param socket       UDP socket object
+/// \param data         Pointer to the array to fill with the received bytes
+/// \param maxSize      Maximum number of bytes that can be received
+/// \param sizeReceived This variable is filled with the actual number of bytes received
+/// \param address      Integer address of the peer that sent the data
+/// \param port         Port of the peer that sent the data
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpSocket_ReceiveFrom(sfUdpSocket* socket, char* data, size_t maxSize, size_t* sizeReceived, sfUint32* address, unsigned short* port);
+
+////////////////////////////////////////////////////////////
+/// \brief Send a packet to a remote peer given by an integer address
+///
+/// This function is equivalent to sfUdpSocket_SendPacket, but
+/// the address is given as its integer representation.
+///
+/// \param socket  UDP socket object
+/// \param packet  Packet to send
+/// \param address Integer address of the receiver
+/// \param port    Port of the receiver to send the data to
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpSocket_SendPacketTo(sfUdpSocket* socket, sfPacket* packet, sfUint32 address, unsigned short port);
+
+////////////////////////////////////////////////////////////
+/// \brief Receive a packet and the integer address of its sender
+///
+/// This function is equivalent to sfUdpSocket_ReceivePacket, but
+/// the address of the sender is returned as its integer representation.
+///
+/// \param socket  UDP socket object
+/// \param packet  Packet to fill with the received data
+/// \param address Integer address of the peer that sent the data
+/// \param port    Port of the peer that sent the data
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpSocket_ReceivePacketFrom(sfUdpSocket* socket, sfPacket* packet, sfUint32* address, unsigned short* port);
+
+////////////////////////////////////////////////////////////
+/// \brief Send a datagram made of several segments of data with a UDP socket
+///
+/// The segments are concatenated into a single datagram by
+/// a gathered write, without being copied. Make sure that
+/// their total size is not greater than sfUdpSocket_MaxDatagramSize(),
+/// otherwise this function will fail and no data will be sent.
+///
+/// \param socket  UDP socket object
+/// \param buffers Array of segments to send
+/// \param count   Number of segments in the array
+/// \param address Integer address of the receiver (see sfIpAddress_ToInteger)
+/// \param port    Port of the receiver to send the data to
+///
+/// \return Status code
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API sfSocketStatus sfUdpSocket_SendV(sfUdpSocket* socket, const sfSocketBuffer* buffers, size_t count, sfUint32 address, unsigned short port);
+
+////////////////////////////////////////////////////////////
+/// \brief Send several datagrams at once with a UDP socket
+///
+/// The datagrams are sent in order, with as few system calls
+/// as possible (a single one for up to 64 datagrams on Linux).
+/// Sending stops at the first datagram that can't be sent;
+/// its status is written to \a status.
+///
+/// \param socket    UDP socket object
+/// \param datagrams Array of datagrams to send
+/// \param count     Number of datagrams in the array
+/// \param status    Receives the status of the batch (sfSocketDone if everything was sent); can be NULL
+///
+/// \return Number of datagrams actually sent
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API size_t sfUdpSocket_SendBatch(sfUdpSocket* socket, const sfUdpDatagram* datagrams, size_t count, sfSocketStatus* status);
+
+////////////////////////////////////////////////////////////
+/// \brief Receive several datagrams at once with a UDP socket
+///
+/// In blocking mode, this function waits until at least one
+/// datagram is received; the next ones are received only if
+/// they are already available. In non-blocking mode, it never
+/// waits. The Data and MaxSize members of the datagrams must be
+/// filled by the caller, the other ones are filled by this
+/// function. A datagram larger than its buffer is truncated
+/// to MaxSize bytes and has its Truncated member set to sfTrue,
+/// on every platform.
+///
+/// \param socket    UDP socket object
+/// \param datagrams Array of datagrams to fill
+/// \param count     Number of datagrams in the array
+/// \param status    Receives the status of the batch (sfSocketDone if at least one datagram was received); can be NULL
+///
+/// \return Number of datagrams actually received
+///
+////////////////////////////////////////////////////////////
+CSFML_NETWORK_API size_t sfUdpSocket_ReceiveBatch(sfUdpSocket* socket, sfUdpDatagram* datagrams, size_t count, sfSocketStatus* status);
+
 ////////////////////////////////////////////////////////////
 /// \brief Return the maximum number of bytes that can be
 ///        sent in a single UDP datagram
@@ -51,4 +51,49 @@ typedef struct sfInputStream
 } sfInputStream;
 
 
+////////////////////////////////////////////////////////////
+/// \brief Access patterns of a memory-mapped stream
+///
+/// They are forwarded to the operating system, which uses
+/// them to tune the read-ahead of the mapped pages.
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfInputStreamAccessNormal,     ///< No particular access pattern
+    sfInputStreamAccessSequential, ///< The data is read from the beginning to the end (music, images)
+    sfInputStreamAccessRandom      ///< The data is read at random positions (fonts)
+} sfInputStreamAccess;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Create a stream that reads a file through a memory mapping
+///
+/// The file is mapped in memory instead of being read, so
+/// the callbacks of the stream just copy data from the mapped
+/// pages, without any system call or intermediate buffer.
+/// The stream can be passed to every CreateFromStream function.
+/// It must be destroyed with sfInputStream_DestroyMappedFile, after the
+/// resource that uses it.
+///
+/// \param filename Path of the file to map
+/// \param access   Expected access pattern
+///
+/// \return A new stream, or NULL if the file couldn't be mapped
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API sfInputStream* sfInputStream_CreateFromMappedFile(const char* filename, sfInputStreamAccess access);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy a stream created by sfInputStream_CreateFromMappedFile
+///
+/// Streams that were not created by
+/// sfInputStream_CreateFromMappedFile are left untouched.
+///
+/// \param stream Stream to destroy
+///
+////////////////////////////////////////////////////////////
+CSFML_SYSTEM_API void sfInputStream_DestroyMappedFile(sfInputStream* stream);
+
+
 #endif // SFML_INPUTSTREAM_H
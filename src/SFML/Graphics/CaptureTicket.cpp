@@ -0,0 +1,434 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/CaptureTicket.h>
+#include <SFML/Graphics/CaptureTicketStruct.h>
+#include <SFML/Graphics/ImageStruct.h>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/OpenGL.hpp>
+#include <SFML/Internal.h>
+#include <cstddef>
+#include <string.h>
+
+#if defined(CSFML_SYSTEM_MACOS)
+    #include <dlfcn.h>
+#elif !defined(CSFML_SYSTEM_WINDOWS)
+    #include <GL/glx.h>
+#endif
+
+
+namespace
+{
+    // OpenGL 1.1 headers don't define the pixel buffer object and sync object symbols
+    #ifndef APIENTRY
+        #define APIENTRY
+    #endif
+    #ifndef GL_PIXEL_PACK_BUFFER
+        #define GL_PIXEL_PACK_BUFFER 0x88EB
+    #endif
+    #ifndef GL_STREAM_READ
+        #define GL_STREAM_READ 0x88E1
+    #endif
+    #ifndef GL_READ_ONLY
+        #define GL_READ_ONLY 0x88B8
+    #endif
+    #ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+        #define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+    #endif
+    #ifndef GL_TIMEOUT_EXPIRED
+        #define GL_TIMEOUT_EXPIRED 0x911B
+    #endif
+
+    typedef void      (APIENTRY* GenBuffersFunc)(GLsizei, GLuint*);
+    typedef void      (APIENTRY* DeleteBuffersFunc)(GLsizei, const GLuint*);
+    typedef void      (APIENTRY* BindBufferFunc)(GLenum, GLuint);
+    typedef void      (APIENTRY* BufferDataFunc)(GLenum, std::ptrdiff_t, const GLvoid*, GLenum);
+    typedef GLvoid*   (APIENTRY* MapBufferFunc)(GLenum, GLenum);
+    typedef GLboolean (APIENTRY* UnmapBufferFunc)(GLenum);
+    typedef void*     (APIENTRY* FenceSyncFunc)(GLenum, GLbitfield);
+    typedef GLenum    (APIENTRY* ClientWaitSyncFunc)(void*, GLbitfield, sf::Uint64);
+    typedef void      (APIENTRY* DeleteSyncFunc)(void*);
+
+    // OpenGL functions that are not exported by every OpenGL library
+    struct GLFunctions
+    {
+        GenBuffersFunc     GenBuffers;
+        DeleteBuffersFunc  DeleteBuffers;
+        BindBufferFunc     BindBuffer;
+        BufferDataFunc     BufferData;
+        MapBufferFunc      MapBuffer;
+        UnmapBufferFunc    UnmapBuffer;
+        FenceSyncFunc      FenceSync;
+        ClientWaitSyncFunc ClientWaitSync;
+        DeleteSyncFunc     DeleteSync;
+        bool               BuffersSupported;
+        bool               SyncSupported;
+    };
+
+    // Get the address of an OpenGL function, or NULL if it's not available
+    template <typename T>
+    void LoadFunction(T& function, const char* name, const char* fallbackName)
+    {
+        union
+        {
+            void* Address;
+            T     Function;
+        } result;
+
+    #if defined(CSFML_SYSTEM_WINDOWS)
+        result.Address = reinterpret_cast<void*>(wglGetProcAddress(name));
+        if (!result.Address && fallbackName)
+            result.Address = reinterpret_cast<void*>(wglGetProcAddress(fallbackName));
+    #elif defined(CSFML_SYSTEM_MACOS)
+        result.Address = dlsym(RTLD_DEFAULT, name);
+        if (!result.Address && fallbackName)
+            result.Address = dlsym(RTLD_DEFAULT, fallbackName);
+    #else
+        result.Address = reinterpret_cast<void*>(glXGetProcAddressARB(reinterpret_cast<const GLubyte*>(name)));
+        if (!result.Address && fallbackName)
+            result.Address = reinterpret_cast<void*>(glXGetProcAddressARB(reinterpret_cast<const GLubyte*>(fallbackName)));
+    #endif
+
+        function = result.Function;
+    }
+
+    // Load the OpenGL functions on first use; a context must be active
+    sf::Mutex functionsMutex;
+    const GLFunctions& GetGLFunctions()
+    {
+        static GLFunctions functions;
+        static bool loaded = false;
+
+        sf::Lock lock(functionsMutex);
+
+        if (!loaded)
+        {
+            // Pixel buffer objects are core since OpenGL 2.1 (GL_ARB_pixel_buffer_object before)
+            LoadFunction(functions.GenBuffers, "glGenBuffers", "glGenBuffersARB");
+            LoadFunction(functions.DeleteBuffers, "glDeleteBuffers", "glDeleteBuffersARB");
+            LoadFunction(functions.BindBuffer, "glBindBuffer", "glBindBufferARB");
+            LoadFunction(functions.BufferData, "glBufferData", "glBufferDataARB");
+            LoadFunction(functions.MapBuffer, "glMapBuffer", "glMapBufferARB");
+            LoadFunction(functions.UnmapBuffer, "glUnmapBuffer", "glUnmapBufferARB");
+            functions.BuffersSupported = functions.GenBuffers && functions.DeleteBuffers && functions.BindBuffer &&
+                                         functions.BufferData && functions.MapBuffer && functions.UnmapBuffer;
+
+            // Sync objects are core since OpenGL 3.2 (GL_ARB_sync before, same names)
+            LoadFunction(functions.FenceSync, "glFenceSync", NULL);
+            LoadFunction(functions.ClientWaitSync, "glClientWaitSync", NULL);
+            LoadFunction(functions.DeleteSync, "glDeleteSync", NULL);
+            functions.SyncSupported = functions.BuffersSupported && functions.FenceSync &&
+                                      functions.ClientWaitSync && functions.DeleteSync;
+
+            loaded = true;
+        }
+
+        return functions;
+    }
+
+    // Released buffers are kept for the next captures, which are typically
+    // double or triple buffered; the pool keeps at most this number of them
+    const std::size_t maxPooledBuffers = 3;
+    sf::Mutex poolMutex;
+    std::vector<GLuint> pool;
+
+    GLuint AcquireBuffer()
+    {
+        sf::Lock lock(poolMutex);
+
+        GLuint buffer = 0;
+        if (!pool.empty())
+        {
+            buffer = pool.back();
+            pool.pop_back();
+        }
+        else
+        {
+            GetGLFunctions().GenBuffers(1, &buffer);
+        }
+
+        return buffer;
+    }
+
+    void ReleaseBuffer(GLuint buffer)
+    {
+        sf::Lock lock(poolMutex);
+
+        if (pool.size() < maxPooledBuffers)
+            pool.push_back(buffer);
+        else
+            GetGLFunctions().DeleteBuffers(1, &buffer);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfCaptureTicket::sfCaptureTicket() :
+Width    (0),
+Height   (0),
+RowLength(0),
+FlipRows (false),
+Buffer   (0),
+Fence    (NULL)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+sfCaptureTicket::~sfCaptureTicket()
+{
+    if (Buffer || Fence)
+    {
+        EnsureGlContext();
+
+        if (Fence)
+            GetGLFunctions().DeleteSync(Fence);
+        if (Buffer)
+            ReleaseBuffer(Buffer);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfCaptureTicket::ReadFramebuffer(unsigned int width, unsigned int height, bool flipRows)
+{
+    const GLFunctions& gl = GetGLFunctions();
+
+    Width = width;
+    Height = height;
+    RowLength = width;
+    FlipRows = flipRows;
+
+    if (gl.BuffersSupported)
+    {
+        // Start the transfer to a pixel buffer object, it will be done in the background
+        Buffer = AcquireBuffer();
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, Buffer);
+        gl.BufferData(GL_PIXEL_PACK_BUFFER, width * height * 4, NULL, GL_STREAM_READ);
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        if (gl.SyncSupported)
+            Fence = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+    }
+    else
+    {
+        // No pixel buffer object: read the pixels synchronously
+        Pixels.resize(width * height * 4);
+        if (!Pixels.empty())
+            glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, &Pixels[0]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfCaptureTicket::ReadTexture(const sf::Texture& texture, bool flipRows)
+{
+    EnsureGlContext();
+
+    const GLFunctions& gl = GetGLFunctions();
+
+    // Binding the texture must not disturb the states of the render target that is active in this context
+    GLint previousTexture = 0;
+    GLint previousMatrixMode = 0;
+    GLfloat previousMatrix[16];
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previousTexture);
+    glGetIntegerv(GL_MATRIX_MODE, &previousMatrixMode);
+    glGetFloatv(GL_TEXTURE_MATRIX, previousMatrix);
+
+    // The actual OpenGL texture may be larger than the sf::Texture (if it was rounded up to a power of two)
+    texture.Bind();
+    GLint textureWidth = 0;
+    GLint textureHeight = 0;
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &textureWidth);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &textureHeight);
+
+    Width = texture.GetWidth();
+    Height = texture.GetHeight();
+    RowLength = textureWidth;
+    FlipRows = flipRows;
+
+    if (gl.BuffersSupported)
+    {
+        // Start the transfer to a pixel buffer object, it will be done in the background
+        Buffer = AcquireBuffer();
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, Buffer);
+        gl.BufferData(GL_PIXEL_PACK_BUFFER, textureWidth * textureHeight * 4, NULL, GL_STREAM_READ);
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        if (gl.SyncSupported)
+            Fence = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+    }
+    else
+    {
+        // No pixel buffer object: read the pixels synchronously
+        Pixels.resize(textureWidth * textureHeight * 4);
+        if (!Pixels.empty())
+            glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, &Pixels[0]);
+    }
+
+    // Restore the previous states
+    glBindTexture(GL_TEXTURE_2D, previousTexture);
+    glMatrixMode(GL_TEXTURE);
+    glLoadMatrixf(previousMatrix);
+    glMatrixMode(previousMatrixMode);
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfCaptureTicket::IsReady() const
+{
+    // Without a fence, there's no way to know: the caller will have to wait
+    if (!Fence)
+        return true;
+
+    EnsureGlContext();
+
+    const GLFunctions& gl = GetGLFunctions();
+    if (gl.ClientWaitSync(Fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+        return false;
+
+    // The fence is signaled (or failed), it's no longer needed
+    gl.DeleteSync(Fence);
+    Fence = NULL;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfCaptureTicket::CopyToImage(sf::Image& image) const
+{
+    if ((Width == 0) || (Height == 0))
+        return;
+
+    const sf::Uint8* data = Map();
+    if (data)
+    {
+        if (!FlipRows && (RowLength == Width))
+        {
+            image.Create(Width, Height, data);
+        }
+        else
+        {
+            std::vector<sf::Uint8> pixels(Width * Height * 4);
+            CopyRows(data, &pixels[0]);
+            image.Create(Width, Height, &pixels[0]);
+        }
+    }
+    Unmap();
+}
+
+
+////////////////////////////////////////////////////////////
+void sfCaptureTicket::CopyPixels(sf::Uint8* pixels) const
+{
+    if ((Width == 0) || (Height == 0))
+        return;
+
+    const sf::Uint8* data = Map();
+    if (data)
+        CopyRows(data, pixels);
+    Unmap();
+}
+
+
+////////////////////////////////////////////////////////////
+const sf::Uint8* sfCaptureTicket::Map() const
+{
+    // Get the pixels from the pixel buffer object if any
+    if (Buffer)
+    {
+        EnsureGlContext();
+
+        const GLFunctions& gl = GetGLFunctions();
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, Buffer);
+
+        return static_cast<const sf::Uint8*>(gl.MapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
+    }
+    else
+    {
+        return Pixels.empty() ? NULL : &Pixels[0];
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfCaptureTicket::Unmap() const
+{
+    if (Buffer)
+    {
+        const GLFunctions& gl = GetGLFunctions();
+        gl.UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfCaptureTicket::CopyRows(const sf::Uint8* source, sf::Uint8* destination) const
+{
+    // Crop the rows to the image width, and flip them if they are bottom-to-top
+    for (unsigned int y = 0; y < Height; ++y)
+    {
+        unsigned int sourceRow = FlipRows ? Height - y - 1 : y;
+        memcpy(destination + y * Width * 4, source + sourceRow * RowLength * 4, Width * 4);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfCaptureTicket_IsReady(const sfCaptureTicket* ticket)
+{
+    CSFML_CHECK_RETURN(ticket, sfFalse);
+
+    return ticket->IsReady() ? sfTrue : sfFalse;
+}
+
+
+////////////////////////////////////////////////////////////
+sfImage* sfCaptureTicket_GetImage(sfCaptureTicket* ticket)
+{
+    CSFML_CHECK_RETURN(ticket, NULL);
+
+    sfImage* image = new sfImage;
+    ticket->CopyToImage(image->This);
+
+    return image;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfCaptureTicket_Destroy(sfCaptureTicket* ticket)
+{
+    delete ticket;
+}
@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_CAPTURETICKETSTRUCT_H
+#define SFML_CAPTURETICKETSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Window/GlResource.hpp>
+#include <vector>
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfCaptureTicket
+//
+// The pixels are read into a pixel buffer object, with a
+// fence to know when the transfer is done. If pixel buffer
+// objects are not supported, they are read synchronously
+// into Pixels instead.
+////////////////////////////////////////////////////////////
+struct sfCaptureTicket : private sf::GlResource
+{
+    sfCaptureTicket();
+    ~sfCaptureTicket();
+
+    // Start reading a region of the current framebuffer
+    void ReadFramebuffer(unsigned int width, unsigned int height, bool flipRows);
+
+    // Start reading the contents of a texture, whose rows may be stored bottom-to-top
+    void ReadTexture(const sf::Texture& texture, bool flipRows);
+
+    // Tell whether CopyToImage won't block
+    bool IsReady() const;
+
+    // Copy the captured pixels to an image, waiting for them if needed
+    void CopyToImage(sf::Image& image) const;
+
+    // Copy the captured pixels to an array of Width * Height * 4 bytes, waiting for them if needed
+    void CopyPixels(sf::Uint8* pixels) const;
+
+    unsigned int           Width;
+    unsigned int           Height;
+    unsigned int           RowLength;
+    bool                   FlipRows;
+    unsigned int           Buffer;
+    mutable void*          Fence;
+    std::vector<sf::Uint8> Pixels;
+
+private :
+
+    // Get access to the captured pixels, and release it
+    const sf::Uint8* Map() const;
+    void Unmap() const;
+
+    // Copy the rows of the captured pixels to a tightly packed top-to-bottom array
+    void CopyRows(const sf::Uint8* source, sf::Uint8* destination) const;
+
+    sfCaptureTicket(const sfCaptureTicket&);
+    sfCaptureTicket& operator =(const sfCaptureTicket&);
+};
+
+
+#endif // SFML_CAPTURETICKETSTRUCT_H
@@ -0,0 +1,232 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/DrawCommandList.h>
+#include <SFML/Graphics/DrawCommandListStruct.h>
+#include <SFML/Graphics/SpriteStruct.h>
+#include <SFML/Graphics/TextStruct.h>
+#include <SFML/Graphics/ShapeStruct.h>
+#include <SFML/Graphics/CircleShapeStruct.h>
+#include <SFML/Graphics/ConvexShapeStruct.h>
+#include <SFML/Graphics/RectangleShapeStruct.h>
+#include <SFML/Graphics/VertexArrayStruct.h>
+#include <SFML/Graphics/ConvertRenderStates.hpp>
+#include <SFML/Internal.h>
+#include <algorithm>
+#include <functional>
+
+
+namespace
+{
+    // Functions returning the texture currently used by the recorded objects
+    const sf::Texture* GetSpriteTexture(const sf::Drawable& drawable)
+    {
+        return static_cast<const sf::Sprite&>(drawable).GetTexture();
+    }
+    const sf::Texture* GetTextTexture(const sf::Drawable& drawable)
+    {
+        const sf::Text& text = static_cast<const sf::Text&>(drawable);
+        return &text.GetFont().GetTexture(text.GetCharacterSize());
+    }
+    const sf::Texture* GetShapeTexture(const sf::Drawable& drawable)
+    {
+        return static_cast<const sf::Shape&>(drawable).GetTexture();
+    }
+
+    // Record a command; getTexture returns the texture used by the object itself, if it has one
+    void AddCommand(sfDrawCommandList* list, const sf::Drawable& drawable, sfDrawableTextureGetter getTexture, const sfRenderStates* states, unsigned int sortKey)
+    {
+        sfDrawCommand command;
+        command.Drawable = &drawable;
+        command.GetTexture = getTexture;
+        command.FirstVertex = 0;
+        command.VertexCount = 0;
+        command.Type = sf::Points;
+        command.States = ConvertRenderStates(states);
+        command.Texture = command.States.Texture;
+        command.SortKey = sortKey;
+
+        list->Commands.push_back(command);
+    }
+
+    // Order of the commands: key first, then the states that are the most expensive to change
+    struct CommandCompare
+    {
+        bool operator ()(const sfDrawCommand& left, const sfDrawCommand& right) const
+        {
+            std::less<const void*> less;
+
+            if (left.SortKey != right.SortKey)
+                return left.SortKey < right.SortKey;
+            if (left.States.Shader != right.States.Shader)
+                return less(left.States.Shader, right.States.Shader);
+            if (left.Texture != right.Texture)
+                return less(left.Texture, right.Texture);
+
+            return left.States.BlendMode < right.States.BlendMode;
+        }
+    };
+}
+
+
+////////////////////////////////////////////////////////////
+sfDrawCommandList* sfDrawCommandList_Create(void)
+{
+    return new sfDrawCommandList;
+}
+
+
+////////////////////////////////////////////////////////////
+sfDrawCommandList* sfDrawCommandList_Copy(sfDrawCommandList* list)
+{
+    CSFML_CHECK_RETURN(list, NULL);
+
+    return new sfDrawCommandList(*list);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfDrawCommandList_Destroy(sfDrawCommandList* list)
+{
+    delete list;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfDrawCommandList_Clear(sfDrawCommandList* list)
+{
+    CSFML_CHECK(list);
+
+    list->Commands.clear();
+    list->Vertices.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfDrawCommandList_GetCommandCount(const sfDrawCommandList* list)
+{
+    CSFML_CHECK_RETURN(list, 0);
+
+    return static_cast<unsigned int>(list->Commands.size());
+}
+
+
+////////////////////////////////////////////////////////////
+void sfDrawCommandList_AddSprite(sfDrawCommandList* list, const sfSprite* object, const sfRenderStates* states, unsigned int sortKey)
+{
+    CSFML_CHECK(list);
+    CSFML_CHECK(object);
+
+    AddCommand(list, object->This, &GetSpriteTexture, states, sortKey);
+}
+void sfDrawCommandList_AddText(sfDrawCommandList* list, const sfText* object, const sfRenderStates* states, unsigned int sortKey)
+{
+    CSFML_CHECK(list);
+    CSFML_CHECK(object);
+
+    AddCommand(list, object->This, &GetTextTexture, states, sortKey);
+}
+void sfDrawCommandList_AddShape(sfDrawCommandList* list, const sfShape* object, const sfRenderStates* states, unsigned int sortKey)
+{
+    CSFML_CHECK(list);
+    CSFML_CHECK(object);
+
+    AddCommand(list, object->This, &GetShapeTexture, states, sortKey);
+}
+void sfDrawCommandList_AddCircleShape(sfDrawCommandList* list, const sfCircleShape* object, const sfRenderStates* states, unsigned int sortKey)
+{
+    CSFML_CHECK(list);
+    CSFML_CHECK(object);
+
+    AddCommand(list, object->This, &GetShapeTexture, states, sortKey);
+}
+void sfDrawCommandList_AddConvexShape(sfDrawCommandList* list, const sfConvexShape* object, const sfRenderStates* states, unsigned int sortKey)
+{
+    CSFML_CHECK(list);
+    CSFML_CHECK(object);
+
+    AddCommand(list, object->This, &GetShapeTexture, states, sortKey);
+}
+void sfDrawCommandList_AddRectangleShape(sfDrawCommandList* list, const sfRectangleShape* object, const sfRenderStates* states, unsigned int sortKey)
+{
+    CSFML_CHECK(list);
+    CSFML_CHECK(object);
+
+    AddCommand(list, object->This, &GetShapeTexture, states, sortKey);
+}
+void sfDrawCommandList_AddVertexArray(sfDrawCommandList* list, const sfVertexArray* object, const sfRenderStates* states, unsigned int sortKey)
+{
+    CSFML_CHECK(list);
+    CSFML_CHECK(object);
+
+    AddCommand(list, object->This, NULL, states, sortKey);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfDrawCommandList_AddPrimitives(sfDrawCommandList* list,
+                                     const sfVertex* vertices, unsigned int vertexCount,
+                                     sfPrimitiveType type, const sfRenderStates* states,
+                                     unsigned int sortKey)
+{
+    CSFML_CHECK(list);
+
+    if (!vertices || (vertexCount == 0))
+        return;
+
+    sfDrawCommand command;
+    command.Drawable = NULL;
+    command.GetTexture = NULL;
+    command.FirstVertex = static_cast<unsigned int>(list->Vertices.size());
+    command.VertexCount = vertexCount;
+    command.Type = static_cast<sf::PrimitiveType>(type);
+    command.States = ConvertRenderStates(states);
+    command.Texture = command.States.Texture;
+    command.SortKey = sortKey;
+    list->Commands.push_back(command);
+
+    // sfVertex and sf::Vertex have the same memory layout
+    const sf::Vertex* begin = reinterpret_cast<const sf::Vertex*>(vertices);
+    list->Vertices.insert(list->Vertices.end(), begin, begin + vertexCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfDrawCommandList_Sort(sfDrawCommandList* list)
+{
+    CSFML_CHECK(list);
+
+    // The textures of the objects may have changed since they were recorded
+    for (std::vector<sfDrawCommand>::iterator it = list->Commands.begin(); it != list->Commands.end(); ++it)
+    {
+        const sf::Texture* texture = it->GetTexture ? it->GetTexture(*it->Drawable) : NULL;
+        it->Texture = texture ? texture : it->States.Texture;
+    }
+
+    std::stable_sort(list->Commands.begin(), list->Commands.end(), CommandCompare());
+}
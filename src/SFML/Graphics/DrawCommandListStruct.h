@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_DRAWCOMMANDLISTSTRUCT_H
+#define SFML_DRAWCOMMANDLISTSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
+
+
+////////////////////////////////////////////////////////////
+// Function returning the texture currently used by a drawable
+////////////////////////////////////////////////////////////
+typedef const sf::Texture* (*sfDrawableTextureGetter)(const sf::Drawable&);
+
+
+////////////////////////////////////////////////////////////
+// Recorded draw call
+////////////////////////////////////////////////////////////
+struct sfDrawCommand
+{
+    const sf::Drawable*     Drawable;    ///< Object to draw, or NULL for primitives
+    sfDrawableTextureGetter GetTexture;  ///< Function returning the texture of the object, or NULL if it has none
+    unsigned int            FirstVertex; ///< Index of the first vertex, for primitives
+    unsigned int            VertexCount; ///< Number of vertices, for primitives
+    sf::PrimitiveType       Type;        ///< Type of primitives
+    sf::RenderStates        States;
+    const sf::Texture*      Texture;     ///< Texture actually used by the command, updated when sorting
+    unsigned int            SortKey;
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfDrawCommandList
+////////////////////////////////////////////////////////////
+struct sfDrawCommandList
+{
+    void Draw(sf::RenderTarget& target) const
+    {
+        for (std::vector<sfDrawCommand>::const_iterator it = Commands.begin(); it != Commands.end(); ++it)
+        {
+            if (it->Drawable)
+                target.Draw(*it->Drawable, it->States);
+            else
+                target.Draw(&Vertices[it->FirstVertex], it->VertexCount, it->Type, it->States);
+        }
+    }
+
+    std::vector<sfDrawCommand> Commands;
+    std::vector<sf::Vertex>    Vertices;
+};
+
+
+#endif // SFML_DRAWCOMMANDLISTSTRUCT_H
@@ -29,6 +29,25 @@
 #include <SFML/Graphics/FontStruct.h>
 #include <SFML/Internal.h>
 #include <SFML/CallbackStream.h>
+#include <algorithm>
+
+
+namespace
+{
+    // Convert a SFML glyph to a CSFML glyph
+    void ConvertGlyph(const sf::Glyph& SFMLGlyph, sfGlyph& glyph)
+    {
+        glyph.Advance            = SFMLGlyph.Advance;
+        glyph.Bounds.Left        = SFMLGlyph.Bounds.Left;
+        glyph.Bounds.Top         = SFMLGlyph.Bounds.Top;
+        glyph.Bounds.Width       = SFMLGlyph.Bounds.Width;
+        glyph.Bounds.Height      = SFMLGlyph.Bounds.Height;
+        glyph.TextureRect.Left   = SFMLGlyph.TextureRect.Left;
+        glyph.TextureRect.Top    = SFMLGlyph.TextureRect.Top;
+        glyph.TextureRect.Width  = SFMLGlyph.TextureRect.Width;
+        glyph.TextureRect.Height = SFMLGlyph.TextureRect.Height;
+    }
+}
 
 
 ////////////////////////////////////////////////////////////
@@ -89,7 +108,12 @@ sfFont* sfFont_Copy(sfFont* font)
 {
     CSFML_CHECK_RETURN(font, NULL);
 
-    return new sfFont(*font);
+    // The texture views refer to the source font, they must not be copied
+    sfFont* copy = new sfFont;
+    copy->This = font->This;
+    copy->Stream = font->Stream;
+
+    return copy;
 }
 
 
@@ -110,17 +134,7 @@ sfGlyph sfFont_GetGlyph(sfFont* font, sfUint32 codePoint, unsigned int character
     sfGlyph glyph = {0, {0, 0, 0, 0}, {0, 0, 0, 0}};
     CSFML_CHECK_RETURN(font, glyph);
 
-    sf::Glyph SFMLGlyph = font->This.GetGlyph(codePoint, characterSize, bold == sfTrue);
-
-    glyph.Advance            = SFMLGlyph.Advance;
-    glyph.Bounds.Left        = SFMLGlyph.Bounds.Left;
-    glyph.Bounds.Top         = SFMLGlyph.Bounds.Top;
-    glyph.Bounds.Width       = SFMLGlyph.Bounds.Width;
-    glyph.Bounds.Height      = SFMLGlyph.Bounds.Height;
-    glyph.TextureRect.Left   = SFMLGlyph.TextureRect.Left;
-    glyph.TextureRect.Top    = SFMLGlyph.TextureRect.Top;
-    glyph.TextureRect.Width  = SFMLGlyph.TextureRect.Width;
-    glyph.TextureRect.Height = SFMLGlyph.TextureRect.Height;
+    ConvertGlyph(font->This.GetGlyph(codePoint, characterSize, bold == sfTrue), glyph);
 
     return glyph;
 }
@@ -135,6 +149,37 @@ int sfFont_GetKerning(sfFont* font, sfUint32 first, sfUint32 second, unsigned in
 }
 
 
+////////////////////////////////////////////////////////////
+/// Get many glyphs of a font at once
+////////////////////////////////////////////////////////////
+void sfFont_GetGlyphs(sfFont* font, const sfUint32* codePoints, size_t count, unsigned int characterSize, sfBool bold, sfGlyph* glyphs)
+{
+    CSFML_CHECK(font);
+    CSFML_CHECK(codePoints);
+    CSFML_CHECK(glyphs);
+
+    for (size_t i = 0; i < count; ++i)
+        ConvertGlyph(font->This.GetGlyph(codePoints[i], characterSize, bold == sfTrue), glyphs[i]);
+}
+
+
+////////////////////////////////////////////////////////////
+/// Get the kerning values of all the pairs of a set of characters
+////////////////////////////////////////////////////////////
+void sfFont_GetKerningTable(sfFont* font, const sfUint32* codePoints, size_t count, unsigned int characterSize, int* table)
+{
+    CSFML_CHECK(font);
+    CSFML_CHECK(codePoints);
+    CSFML_CHECK(table);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = 0; j < count; ++j)
+            table[i * count + j] = font->This.GetKerning(codePoints[i], codePoints[j], characterSize);
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 /// Get the line spacing value
 ////////////////////////////////////////////////////////////
@@ -151,9 +196,77 @@ const sfTexture* sfFont_GetTexture(sfFont* font, unsigned int characterSize)
 {
     CSFML_CHECK_RETURN(font, NULL);
 
-    *font->Textures[characterSize].This = font->This.GetTexture(characterSize);
+    // Wrap the font's own texture rather than copying it; sf::Font never
+    // relocates the texture of a character size, so the view stays valid
+    sfTexture& texture = font->Textures[characterSize];
+    if (texture.OwnInstance)
+    {
+        delete texture.This;
+        texture.This = const_cast<sf::Texture*>(&font->This.GetTexture(characterSize));
+        texture.OwnInstance = false;
+    }
+
+    return &texture;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Get the generation counter of the texture containing the glyphs
+/// of a given size in a font
+////////////////////////////////////////////////////////////
+unsigned int sfFont_GetTextureGeneration(sfFont* font, unsigned int characterSize)
+{
+    CSFML_CHECK_RETURN(font, 0);
+
+    const sf::Texture& texture = font->This.GetTexture(characterSize);
+
+    sfFontTextureInfo& info = font->TextureInfos[characterSize];
+    if ((texture.GetWidth() != info.Width) || (texture.GetHeight() != info.Height))
+    {
+        info.Width = texture.GetWidth();
+        info.Height = texture.GetHeight();
+        info.Generation++;
+    }
+
+    return info.Generation;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Load glyphs in advance
+////////////////////////////////////////////////////////////
+size_t sfFont_PreloadGlyphs(sfFont* font, const sfUint32* ranges, size_t rangeCount,
+                            const unsigned int* sizes, size_t sizeCount, sfBool bold)
+{
+    CSFML_CHECK_RETURN(font, 0);
+    CSFML_CHECK_RETURN(sizes, 0);
+
+    size_t memory = 0;
+    for (size_t i = 0; i < sizeCount; ++i)
+    {
+        // Don't count the same texture twice
+        if (std::find(sizes, sizes + i, sizes[i]) != sizes + i)
+            continue;
+
+        // Requesting a glyph loads it and adds it to the texture if it's not there yet
+        if (ranges)
+        {
+            for (size_t j = 0; j < rangeCount; ++j)
+            {
+                for (sf::Uint32 codePoint = ranges[j * 2]; codePoint <= ranges[j * 2 + 1]; ++codePoint)
+                {
+                    font->This.GetGlyph(codePoint, sizes[i], bold == sfTrue);
+                    if (codePoint == 0xFFFFFFFF)
+                        break;
+                }
+            }
+        }
+
+        const sf::Texture& texture = font->This.GetTexture(sizes[i]);
+        memory += static_cast<size_t>(texture.GetWidth()) * texture.GetHeight() * 4;
+    }
 
-    return &font->Textures[characterSize];
+    return memory;
 }
 
 
@@ -34,6 +34,24 @@
 #include <map>
 
 
+////////////////////////////////////////////////////////////
+// Generation tracking of the glyph texture of a character size
+////////////////////////////////////////////////////////////
+struct sfFontTextureInfo
+{
+    sfFontTextureInfo() :
+    Width     (0),
+    Height    (0),
+    Generation(0)
+    {
+    }
+
+    unsigned int Width;
+    unsigned int Height;
+    unsigned int Generation;
+};
+
+
 ////////////////////////////////////////////////////////////
 // Internal structure of sfFont
 ////////////////////////////////////////////////////////////
@@ -42,6 +60,7 @@ struct sfFont
     sf::Font This;
     std::map<unsigned int, sfTexture> Textures;
     CallbackStream Stream;
+    std::map<unsigned int, sfFontTextureInfo> TextureInfos;
 };
 
 
@@ -0,0 +1,425 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/FrameRecorder.h>
+#include <SFML/Graphics/FrameRecorderStruct.h>
+#include <SFML/Graphics/CaptureTicketStruct.h>
+#include <SFML/Graphics/RenderTexture.h>
+#include <SFML/Graphics/RenderTextureStruct.h>
+#include <SFML/System/Lock.hpp>
+#include <SFML/Internal.h>
+#include <SFML/Simd.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace
+{
+    // Fixed-point coefficients (8 bits of fraction) of the full range BT.601 conversion,
+    // which is what the "C420jpeg" colorspace of Y4M files expects
+    const short YCoefficients[3] = { 77,  150,  29};
+    const short UCoefficients[3] = {-43, -85,   128};
+    const short VCoefficients[3] = {128, -107, -21};
+    const int   YBias            = 128;
+    const int   ChromaBias       = 128 + (128 << 8);
+
+    // Compute a weighted sum of the RGB components of each pixel, scaled down to 8 bits
+    sf::Uint8 WeightPixel(const sf::Uint8* pixel, const short* coefficients, int bias)
+    {
+        int value = (pixel[0] * coefficients[0] + pixel[1] * coefficients[1] + pixel[2] * coefficients[2] + bias) >> 8;
+        return static_cast<sf::Uint8>(std::min(std::max(value, 0), 255));
+    }
+
+    void ConvertPlane(const sf::Uint8* pixels, std::size_t count, const short* coefficients, int bias, sf::Uint8* plane)
+    {
+        std::size_t i = 0;
+
+    #if defined(CSFML_SIMD_SSE2)
+
+        // 16 pixels per iteration: the products of each pixel are summed with madd, then
+        // the partial sums of the two halves of each pixel are added together
+        const __m128i weights = _mm_setr_epi16(coefficients[0], coefficients[1], coefficients[2], 0,
+                                               coefficients[0], coefficients[1], coefficients[2], 0);
+        const __m128i offset = _mm_set1_epi32(bias);
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= count; i += 16)
+        {
+            __m128i sums[4];
+            for (int j = 0; j < 4; ++j)
+            {
+                __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + (i + j * 4) * 4));
+                __m128 low  = _mm_castsi128_ps(_mm_madd_epi16(_mm_unpacklo_epi8(source, zero), weights));
+                __m128 high = _mm_castsi128_ps(_mm_madd_epi16(_mm_unpackhi_epi8(source, zero), weights));
+                __m128i rg = _mm_castps_si128(_mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+                __m128i b  = _mm_castps_si128(_mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)));
+                sums[j] = _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(rg, b), offset), 8);
+            }
+            __m128i packed = _mm_packus_epi16(_mm_packs_epi32(sums[0], sums[1]), _mm_packs_epi32(sums[2], sums[3]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(plane + i), packed);
+        }
+
+    #elif defined(CSFML_SIMD_NEON)
+
+        // 8 pixels per iteration, deinterleaved by the load and accumulated in 32 bits
+        const int32x4_t offset = vdupq_n_s32(bias);
+        for (; i + 8 <= count; i += 8)
+        {
+            uint8x8x4_t source = vld4_u8(pixels + i * 4);
+            int16x8_t r = vreinterpretq_s16_u16(vmovl_u8(source.val[0]));
+            int16x8_t g = vreinterpretq_s16_u16(vmovl_u8(source.val[1]));
+            int16x8_t b = vreinterpretq_s16_u16(vmovl_u8(source.val[2]));
+
+            int32x4_t low = vmull_n_s16(vget_low_s16(r), coefficients[0]);
+            low = vmlal_n_s16(low, vget_low_s16(g), coefficients[1]);
+            low = vmlal_n_s16(low, vget_low_s16(b), coefficients[2]);
+            low = vshrq_n_s32(vaddq_s32(low, offset), 8);
+
+            int32x4_t high = vmull_n_s16(vget_high_s16(r), coefficients[0]);
+            high = vmlal_n_s16(high, vget_high_s16(g), coefficients[1]);
+            high = vmlal_n_s16(high, vget_high_s16(b), coefficients[2]);
+            high = vshrq_n_s32(vaddq_s32(high, offset), 8);
+
+            vst1_u8(plane + i, vqmovn_u16(vcombine_u16(vqmovun_s32(low), vqmovun_s32(high))));
+        }
+
+    #endif
+
+        for (; i < count; ++i)
+            plane[i] = WeightPixel(pixels + i * 4, coefficients, bias);
+    }
+
+    // Average each 2x2 block of pixels of two rows, to get a row of (width + 1) / 2 pixels
+    void Downsample(const sf::Uint8* row0, const sf::Uint8* row1, unsigned int width, sf::Uint8* half)
+    {
+        unsigned int count = width / 2;
+        unsigned int i = 0;
+
+    #if defined(CSFML_SIMD_SSE2)
+
+        // 4 output pixels per iteration: average the rows, then the even and odd columns
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i first  = _mm_avg_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + i * 8)),
+                                          _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + i * 8)));
+            __m128i second = _mm_avg_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + i * 8 + 16)),
+                                          _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + i * 8 + 16)));
+            __m128 even = _mm_shuffle_ps(_mm_castsi128_ps(first), _mm_castsi128_ps(second), _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 odd  = _mm_shuffle_ps(_mm_castsi128_ps(first), _mm_castsi128_ps(second), _MM_SHUFFLE(3, 1, 3, 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(half + i * 4), _mm_avg_epu8(_mm_castps_si128(even), _mm_castps_si128(odd)));
+        }
+
+    #elif defined(CSFML_SIMD_NEON)
+
+        // 8 output pixels per iteration: average the rows, then add adjacent columns pairwise
+        for (; i + 8 <= count; i += 8)
+        {
+            uint8x16x4_t first  = vld4q_u8(row0 + i * 8);
+            uint8x16x4_t second = vld4q_u8(row1 + i * 8);
+            uint8x8x4_t result;
+            for (int c = 0; c < 4; ++c)
+                result.val[c] = vrshrn_n_u16(vpaddlq_u8(vrhaddq_u8(first.val[c], second.val[c])), 1);
+            vst4_u8(half + i * 4, result);
+        }
+
+    #endif
+
+        for (; i < count; ++i)
+        {
+            for (int c = 0; c < 4; ++c)
+                half[i * 4 + c] = static_cast<sf::Uint8>((row0[i * 8 + c] + row0[i * 8 + 4 + c] + row1[i * 8 + c] + row1[i * 8 + 4 + c] + 2) >> 2);
+        }
+
+        // The last column of an odd width is only averaged vertically
+        if (width % 2 != 0)
+        {
+            for (int c = 0; c < 4; ++c)
+                half[count * 4 + c] = static_cast<sf::Uint8>((row0[(width - 1) * 4 + c] + row1[(width - 1) * 4 + c] + 1) >> 1);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFrameRecorder::Write()
+{
+    for (;;)
+    {
+        // Take the next frame in the queue; when it is empty, the thread stops
+        // and will be launched again by the next queued frame
+        Frame* frame = NULL;
+        bool failed;
+        {
+            sf::Lock lock(Mutex);
+
+            if (Queue.empty())
+            {
+                Writing = false;
+                return;
+            }
+
+            frame = Queue.front();
+            Queue.pop_front();
+            failed = Failed;
+        }
+
+        // Convert and write the frame, without holding the lock
+        bool written = !failed && WriteFrame(*frame);
+
+        sf::Lock lock(Mutex);
+
+        if (!written)
+            Failed = true;
+        FreeFrames.push_back(frame);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool sfFrameRecorder::WriteFrame(const Frame& frame)
+{
+    if (Format == sfFrameRecorderRawRGBA)
+        return std::fwrite(&frame[0], 1, frame.size(), File) == frame.size();
+
+    // Convert to planar YUV 4:2:0: full resolution luma, chroma of 2x2 averaged pixels
+    unsigned int chromaWidth = (Width + 1) / 2;
+    unsigned int chromaHeight = (Height + 1) / 2;
+    std::size_t lumaSize = static_cast<std::size_t>(Width) * Height;
+    std::size_t chromaSize = static_cast<std::size_t>(chromaWidth) * chromaHeight;
+
+    Planes.resize(lumaSize + chromaSize * 2);
+    HalfRow.resize(chromaWidth * 4);
+    sf::Uint8* y = &Planes[0];
+    sf::Uint8* u = y + lumaSize;
+    sf::Uint8* v = u + chromaSize;
+
+    ConvertPlane(&frame[0], lumaSize, YCoefficients, YBias, y);
+    for (unsigned int row = 0; row < chromaHeight; ++row)
+    {
+        // The last row of an odd height is averaged with itself
+        const sf::Uint8* row0 = &frame[row * 2 * Width * 4];
+        const sf::Uint8* row1 = (row * 2 + 1 < Height) ? row0 + Width * 4 : row0;
+
+        Downsample(row0, row1, Width, &HalfRow[0]);
+        ConvertPlane(&HalfRow[0], chromaWidth, UCoefficients, ChromaBias, u + row * chromaWidth);
+        ConvertPlane(&HalfRow[0], chromaWidth, VCoefficients, ChromaBias, v + row * chromaWidth);
+    }
+
+    return (std::fputs("FRAME\n", File) >= 0) && (std::fwrite(&Planes[0], 1, Planes.size(), File) == Planes.size());
+}
+
+
+namespace
+{
+    // Get an unused frame buffer of a recorder
+    sfFrameRecorder::Frame* AcquireFrame(sfFrameRecorder* recorder)
+    {
+        {
+            sf::Lock lock(recorder->Mutex);
+
+            if (!recorder->FreeFrames.empty())
+            {
+                sfFrameRecorder::Frame* frame = recorder->FreeFrames.back();
+                recorder->FreeFrames.pop_back();
+                return frame;
+            }
+        }
+
+        return new sfFrameRecorder::Frame(recorder->Width * recorder->Height * 4);
+    }
+
+    // Check whether a new frame must be dropped
+    bool IsFull(const sfFrameRecorder* recorder)
+    {
+        sf::Lock lock(recorder->Mutex);
+
+        return recorder->Failed || (recorder->Captures.size() + recorder->Queue.size() >= recorder->MaxQueuedFrames);
+    }
+
+    // Hand the captured frames over to the writer thread, in order, either
+    // only those whose transfer is finished or all of them
+    void FlushCaptures(sfFrameRecorder* recorder, bool wait)
+    {
+        while (!recorder->Captures.empty())
+        {
+            sfFrameRecorder::Capture& capture = recorder->Captures.front();
+            if (capture.Ticket)
+            {
+                if (!wait && !capture.Ticket->IsReady())
+                    break;
+
+                capture.Ticket->CopyPixels(&(*capture.Pixels)[0]);
+                delete capture.Ticket;
+            }
+
+            bool launch = false;
+            {
+                sf::Lock lock(recorder->Mutex);
+                recorder->Queue.push_back(capture.Pixels);
+                recorder->Captures.pop_front();
+
+                if (!recorder->Writing)
+                {
+                    recorder->Writing = true;
+                    launch = true;
+                }
+            }
+
+            // Wake up the writer if it had stopped (this also waits for its previous run to return)
+            if (launch)
+                recorder->Writer->Launch();
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfFrameRecorder* sfFrameRecorder_Create(const char* filename, unsigned int width, unsigned int height, unsigned int frameRate, sfFrameRecorderFormat format, unsigned int maxQueuedFrames)
+{
+    CSFML_CHECK_RETURN(filename, NULL);
+
+    if ((width == 0) || (height == 0))
+        return NULL;
+
+    std::FILE* file = std::fopen(filename, "wb");
+    if (!file)
+        return NULL;
+
+    if (format == sfFrameRecorderY4M)
+        std::fprintf(file, "YUV4MPEG2 W%u H%u F%u:1 Ip A1:1 C420jpeg\n", width, height, std::max(frameRate, 1u));
+
+    sfFrameRecorder* recorder = new sfFrameRecorder;
+    recorder->File = file;
+    recorder->Format = format;
+    recorder->Width = width;
+    recorder->Height = height;
+    recorder->MaxQueuedFrames = std::max(maxQueuedFrames, 1u);
+    recorder->FrameCount = 0;
+    recorder->DroppedFrameCount = 0;
+    recorder->Writing = false;
+    recorder->Failed = false;
+
+    // The writer is only launched when there are frames to write
+    recorder->Writer = new sf::Thread(&sfFrameRecorder::Write, recorder);
+
+    return recorder;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfFrameRecorder_Destroy(sfFrameRecorder* recorder)
+{
+    if (!recorder)
+        return;
+
+    // Write all the remaining frames; the writer stops once the queue is empty
+    FlushCaptures(recorder, true);
+    recorder->Writer->Wait();
+    delete recorder->Writer;
+
+    for (std::vector<sfFrameRecorder::Frame*>::iterator it = recorder->FreeFrames.begin(); it != recorder->FreeFrames.end(); ++it)
+        delete *it;
+
+    std::fclose(recorder->File);
+
+    delete recorder;
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfFrameRecorder_AddFrame(sfFrameRecorder* recorder, sfRenderTexture* renderTexture)
+{
+    CSFML_CHECK_RETURN(recorder, sfFalse);
+    CSFML_CHECK_RETURN(renderTexture, sfFalse);
+
+    FlushCaptures(recorder, false);
+
+    if ((renderTexture->This.GetWidth() != recorder->Width) || (renderTexture->This.GetHeight() != recorder->Height))
+        return sfFalse;
+
+    sfCaptureTicket* ticket = IsFull(recorder) ? NULL : sfRenderTexture_CaptureAsync(renderTexture);
+    if (!ticket)
+    {
+        recorder->DroppedFrameCount++;
+        return sfFalse;
+    }
+
+    // The pixels will be handed over to the writer once their transfer is finished
+    sfFrameRecorder::Capture capture;
+    capture.Ticket = ticket;
+    capture.Pixels = AcquireFrame(recorder);
+    recorder->Captures.push_back(capture);
+    recorder->FrameCount++;
+
+    return sfTrue;
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfFrameRecorder_AddFramePixels(sfFrameRecorder* recorder, const sfUint8* pixels)
+{
+    CSFML_CHECK_RETURN(recorder, sfFalse);
+    CSFML_CHECK_RETURN(pixels, sfFalse);
+
+    FlushCaptures(recorder, false);
+
+    if (IsFull(recorder))
+    {
+        recorder->DroppedFrameCount++;
+        return sfFalse;
+    }
+
+    // Queue the frame behind the captures still in transfer, to keep the frames in order
+    sfFrameRecorder::Capture capture;
+    capture.Ticket = NULL;
+    capture.Pixels = AcquireFrame(recorder);
+    std::memcpy(&(*capture.Pixels)[0], pixels, capture.Pixels->size());
+    recorder->Captures.push_back(capture);
+    recorder->FrameCount++;
+
+    FlushCaptures(recorder, false);
+
+    return sfTrue;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfFrameRecorder_GetFrameCount(const sfFrameRecorder* recorder)
+{
+    CSFML_CHECK_RETURN(recorder, 0);
+
+    return recorder->FrameCount;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfFrameRecorder_GetDroppedFrameCount(const sfFrameRecorder* recorder)
+{
+    CSFML_CHECK_RETURN(recorder, 0);
+
+    return recorder->DroppedFrameCount;
+}
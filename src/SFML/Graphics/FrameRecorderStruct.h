@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_FRAMERECORDERSTRUCT_H
+#define SFML_FRAMERECORDERSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/FrameRecorder.h>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Thread.hpp>
+#include <cstdio>
+#include <deque>
+#include <vector>
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfFrameRecorder
+////////////////////////////////////////////////////////////
+struct sfFrameRecorder
+{
+    typedef std::vector<sf::Uint8> Frame;
+
+    // Frame whose pixels may still be in transfer from the graphics card
+    struct Capture
+    {
+        sfCaptureTicket* Ticket;
+        Frame*           Pixels;
+    };
+
+    void Write();
+    bool WriteFrame(const Frame& frame);
+
+    std::FILE*                   File;
+    sfFrameRecorderFormat        Format;
+    unsigned int                 Width;
+    unsigned int                 Height;
+    unsigned int                 MaxQueuedFrames;
+    unsigned int                 FrameCount;
+    unsigned int                 DroppedFrameCount;
+    std::deque<Capture>          Captures;
+    mutable sf::Mutex            Mutex;
+    std::deque<Frame*>           Queue;
+    std::vector<Frame*>          FreeFrames;
+    sf::Thread*                  Writer;
+    bool                         Writing;
+    bool                         Failed;
+    std::vector<sf::Uint8>       Planes;
+    std::vector<sf::Uint8>       HalfRow;
+};
+
+
+#endif // SFML_FRAMERECORDERSTRUCT_H
@@ -27,8 +27,150 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/Image.h>
 #include <SFML/Graphics/ImageStruct.h>
+#include <SFML/Graphics/ImageResampler.hpp>
+#include <SFML/Graphics/PixelKernels.hpp>
 #include <SFML/Internal.h>
 #include <SFML/CallbackStream.h>
+#include <SFML/System/Lock.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Thread.hpp>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+
+namespace
+{
+    // Shared state of a batch of images decoded in parallel
+    struct BatchLoad
+    {
+        const char* const* Filenames;
+        const void* const* Data;
+        const size_t*      Sizes;
+        size_t             Count;
+        sfImage**          Images;
+        size_t             Next;
+        size_t             Loaded;
+        sf::Mutex          Mutex;
+    };
+
+    // Decode images of a batch until there's none left
+    void DecodeBatch(BatchLoad* batch)
+    {
+        size_t loaded = 0;
+        for (;;)
+        {
+            size_t index;
+            {
+                sf::Lock lock(batch->Mutex);
+                if (batch->Next >= batch->Count)
+                    break;
+                index = batch->Next++;
+            }
+
+            sfImage* image = new sfImage;
+            bool success;
+            if (batch->Filenames)
+                success = batch->Filenames[index] && image->This.LoadFromFile(batch->Filenames[index]);
+            else
+                success = batch->Data[index] && image->This.LoadFromMemory(batch->Data[index], batch->Sizes[index]);
+
+            if (success)
+            {
+                loaded++;
+            }
+            else
+            {
+                delete image;
+                image = NULL;
+            }
+
+            batch->Images[index] = image;
+        }
+
+        sf::Lock lock(batch->Mutex);
+        batch->Loaded += loaded;
+    }
+
+    // Decode all the images of a batch with the given number of threads
+    size_t LoadBatch(BatchLoad& batch, unsigned int threadCount)
+    {
+        batch.Next = 0;
+        batch.Loaded = 0;
+
+        // The calling thread is one of the workers
+        if (threadCount > batch.Count)
+            threadCount = static_cast<unsigned int>(batch.Count);
+        std::vector<sf::Thread*> threads;
+        for (unsigned int i = 1; i < threadCount; ++i)
+        {
+            sf::Thread* thread = new sf::Thread(&DecodeBatch, &batch);
+            threads.push_back(thread);
+            thread->Launch();
+        }
+
+        DecodeBatch(&batch);
+
+        for (std::vector<sf::Thread*>::iterator it = threads.begin(); it != threads.end(); ++it)
+        {
+            (*it)->Wait();
+            delete *it;
+        }
+
+        return batch.Loaded;
+    }
+
+    // Get a writable pointer to the pixels of an image, or NULL if it's empty
+    sf::Uint8* GetPixels(sfImage* image)
+    {
+        if ((image->This.GetWidth() == 0) || (image->This.GetHeight() == 0))
+            return NULL;
+
+        return const_cast<sf::Uint8*>(image->This.GetPixelsPtr());
+    }
+
+    // Clip a rectangle to an area of the given size, an empty rectangle meaning the whole area;
+    // return false if nothing is left
+    bool ClipRect(sf::IntRect& rect, unsigned int width, unsigned int height)
+    {
+        if ((rect.Width == 0) || (rect.Height == 0))
+            rect = sf::IntRect(0, 0, width, height);
+
+        int left   = std::max(rect.Left, 0);
+        int top    = std::max(rect.Top, 0);
+        int right  = std::min(rect.Left + rect.Width, static_cast<int>(width));
+        int bottom = std::min(rect.Top + rect.Height, static_cast<int>(height));
+        rect = sf::IntRect(left, top, right - left, bottom - top);
+
+        return (right > left) && (bottom > top);
+    }
+
+    // Check that a rectangle is entirely inside an image, an empty rectangle meaning the whole image
+    bool CheckRect(sf::IntRect& rect, unsigned int width, unsigned int height)
+    {
+        if ((rect.Width == 0) || (rect.Height == 0))
+            rect = sf::IntRect(0, 0, width, height);
+
+        return (rect.Left >= 0) && (rect.Top >= 0) && (rect.Width > 0) && (rect.Height > 0) &&
+               (static_cast<unsigned int>(rect.Left + rect.Width) <= width) &&
+               (static_cast<unsigned int>(rect.Top + rect.Height) <= height);
+    }
+
+    // Copy rows of pixels between two arrays with different strides
+    void CopyRows(sf::Uint8* destination, size_t destinationStride, const sf::Uint8* source, size_t sourceStride, size_t rowSize, unsigned int rows)
+    {
+        if ((destinationStride == rowSize) && (sourceStride == rowSize))
+        {
+            std::memcpy(destination, source, rowSize * rows);
+        }
+        else
+        {
+            for (unsigned int y = 0; y < rows; ++y)
+                std::memcpy(destination + y * destinationStride, source + y * sourceStride, rowSize);
+        }
+    }
+}
+
 
 ////////////////////////////////////////////////////////////
 sfImage* sfImage_Create(unsigned int width, unsigned int height)
@@ -108,6 +250,41 @@ sfImage* sfImage_CreateFromStream(sfInputStream* stream)
 }
 
 
+////////////////////////////////////////////////////////////
+size_t sfImage_CreateFromFilesBatch(const char* const* filenames, size_t count, unsigned int threadCount, sfImage** images)
+{
+    CSFML_CHECK_RETURN(filenames, 0);
+    CSFML_CHECK_RETURN(images, 0);
+
+    BatchLoad batch;
+    batch.Filenames = filenames;
+    batch.Data = NULL;
+    batch.Sizes = NULL;
+    batch.Count = count;
+    batch.Images = images;
+
+    return LoadBatch(batch, threadCount);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfImage_CreateFromMemoryBatch(const void* const* data, const size_t* sizes, size_t count, unsigned int threadCount, sfImage** images)
+{
+    CSFML_CHECK_RETURN(data, 0);
+    CSFML_CHECK_RETURN(sizes, 0);
+    CSFML_CHECK_RETURN(images, 0);
+
+    BatchLoad batch;
+    batch.Filenames = NULL;
+    batch.Data = data;
+    batch.Sizes = sizes;
+    batch.Count = count;
+    batch.Images = images;
+
+    return LoadBatch(batch, threadCount);
+}
+
+
 ////////////////////////////////////////////////////////////
 sfImage* sfImage_Copy(sfImage* image)
 {
@@ -134,16 +311,57 @@ sfBool sfImage_SaveToFile(const sfImage* image, const char* filename)
 ////////////////////////////////////////////////////////////
 void sfImage_CreateMaskFromColor(sfImage* image, sfColor colorKey, sfUint8 alpha)
 {
-    CSFML_CALL(image, CreateMaskFromColor(sf::Color(colorKey.r, colorKey.g, colorKey.b, colorKey.a), alpha));
+    CSFML_CHECK(image);
+
+    sf::Uint8* pixels = GetPixels(image);
+    if (!pixels)
+        return;
+
+    const sf::Uint8 key[4] = {colorKey.r, colorKey.g, colorKey.b, colorKey.a};
+    MaskPixels(pixels, image->This.GetWidth() * image->This.GetHeight(), key, alpha);
 }
 
 
 ////////////////////////////////////////////////////////////
 void sfImage_CopyImage(sfImage* image, const sfImage* source, unsigned int destX, unsigned int destY, sfIntRect sourceRect, sfBool applyAlpha)
 {
+    CSFML_CHECK(image);
     CSFML_CHECK(source);
-    sf::IntRect sfmlRect(sourceRect.Left, sourceRect.Top, sourceRect.Width, sourceRect.Height);
-    CSFML_CALL(image, Copy(source->This, destX, destY, sfmlRect, applyAlpha == sfTrue));
+
+    unsigned int width = image->This.GetWidth();
+    unsigned int height = image->This.GetHeight();
+    unsigned int sourceWidth = source->This.GetWidth();
+    unsigned int sourceHeight = source->This.GetHeight();
+    if ((width == 0) || (height == 0) || (sourceWidth == 0) || (sourceHeight == 0))
+        return;
+
+    // Clip the copied area to both images
+    sf::IntRect rect(sourceRect.Left, sourceRect.Top, sourceRect.Width, sourceRect.Height);
+    if (!ClipRect(rect, sourceWidth, sourceHeight) || (destX >= width) || (destY >= height))
+        return;
+    unsigned int rows = std::min(static_cast<unsigned int>(rect.Height), height - destY);
+    unsigned int columns = std::min(static_cast<unsigned int>(rect.Width), width - destX);
+
+    // When an image is copied onto itself, read from a copy of it so that overlapping areas stay correct
+    sf::Image copy;
+    const sf::Uint8* sourcePixels = source->This.GetPixelsPtr();
+    if (source == image)
+    {
+        copy = source->This;
+        sourcePixels = copy.GetPixelsPtr();
+    }
+
+    sf::Uint8* pixels = GetPixels(image);
+    for (unsigned int y = 0; y < rows; ++y)
+    {
+        const sf::Uint8* sourceRow = sourcePixels + ((rect.Top + y) * sourceWidth + rect.Left) * 4;
+        sf::Uint8* row = pixels + ((destY + y) * width + destX) * 4;
+
+        if (applyAlpha == sfTrue)
+            BlendPixels(row, sourceRow, columns);
+        else
+            std::memcpy(row, sourceRow, columns * 4);
+    }
 }
 
 
@@ -173,6 +391,74 @@ const sfUint8* sfImage_GetPixelsPtr(const sfImage* image)
 }
 
 
+////////////////////////////////////////////////////////////
+sfUint8* sfImage_LockPixels(sfImage* image)
+{
+    CSFML_CHECK_RETURN(image, NULL);
+
+    sf::Uint8* pixels = GetPixels(image);
+    if (!pixels || image->Locked)
+        return NULL;
+
+    image->Locked = true;
+
+    return pixels;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfImage_UnlockPixels(sfImage* image)
+{
+    CSFML_CHECK(image);
+
+    image->Locked = false;
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfImage_ReadPixels(const sfImage* image, sfIntRect rect, sfUint8* pixels, size_t stride)
+{
+    CSFML_CHECK_RETURN(image, sfFalse);
+    CSFML_CHECK_RETURN(pixels, sfFalse);
+
+    unsigned int width = image->This.GetWidth();
+    sf::IntRect area(rect.Left, rect.Top, rect.Width, rect.Height);
+    if (!CheckRect(area, width, image->This.GetHeight()))
+        return sfFalse;
+
+    size_t rowSize = area.Width * 4;
+    if ((stride != 0) && (stride < rowSize))
+        return sfFalse;
+
+    const sf::Uint8* source = image->This.GetPixelsPtr() + (area.Top * width + area.Left) * 4;
+    CopyRows(pixels, stride ? stride : rowSize, source, width * 4, rowSize, area.Height);
+
+    return sfTrue;
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfImage_WritePixels(sfImage* image, sfIntRect rect, const sfUint8* pixels, size_t stride)
+{
+    CSFML_CHECK_RETURN(image, sfFalse);
+    CSFML_CHECK_RETURN(pixels, sfFalse);
+
+    unsigned int width = image->This.GetWidth();
+    sf::IntRect area(rect.Left, rect.Top, rect.Width, rect.Height);
+    if (!CheckRect(area, width, image->This.GetHeight()))
+        return sfFalse;
+
+    size_t rowSize = area.Width * 4;
+    if ((stride != 0) && (stride < rowSize))
+        return sfFalse;
+
+    sf::Uint8* destination = GetPixels(image) + (area.Top * width + area.Left) * 4;
+    CopyRows(destination, width * 4, pixels, stride ? stride : rowSize, rowSize, area.Height);
+
+    return sfTrue;
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int sfImage_GetWidth(const sfImage* image)
 {
@@ -190,12 +476,140 @@ unsigned int sfImage_GetHeight(const sfImage* image)
 ////////////////////////////////////////////////////////////
 void sfImage_FlipHorizontally(sfImage* image)
 {
-    CSFML_CALL(image, FlipHorizontally());
+    CSFML_CHECK(image);
+
+    sf::Uint8* pixels = GetPixels(image);
+    if (!pixels)
+        return;
+
+    unsigned int width = image->This.GetWidth();
+    unsigned int height = image->This.GetHeight();
+    for (unsigned int y = 0; y < height; ++y)
+        ReversePixels(pixels + y * width * 4, width);
 }
 
 
 ////////////////////////////////////////////////////////////
 void sfImage_FlipVertically(sfImage* image)
 {
-    CSFML_CALL(image, FlipVertically());
+    CSFML_CHECK(image);
+
+    sf::Uint8* pixels = GetPixels(image);
+    if (!pixels)
+        return;
+
+    unsigned int width = image->This.GetWidth();
+    unsigned int height = image->This.GetHeight();
+    for (unsigned int y = 0; y < height / 2; ++y)
+        SwapPixels(pixels + y * width * 4, pixels + (height - y - 1) * width * 4, width);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfImage_PremultiplyAlpha(sfImage* image)
+{
+    CSFML_CHECK(image);
+
+    sf::Uint8* pixels = GetPixels(image);
+    if (pixels)
+        PremultiplyPixels(pixels, image->This.GetWidth() * image->This.GetHeight());
+}
+
+
+////////////////////////////////////////////////////////////
+void sfImage_SwizzleChannels(sfImage* image, unsigned int red, unsigned int green, unsigned int blue, unsigned int alpha)
+{
+    CSFML_CHECK(image);
+
+    if ((red > 3) || (green > 3) || (blue > 3) || (alpha > 3))
+        return;
+
+    sf::Uint8* pixels = GetPixels(image);
+    if (!pixels)
+        return;
+
+    const unsigned int order[4] = {red, green, blue, alpha};
+    SwizzlePixels(pixels, image->This.GetWidth() * image->This.GetHeight(), order);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfImage_FillRect(sfImage* image, sfIntRect rect, sfColor color)
+{
+    CSFML_CHECK(image);
+
+    sf::Uint8* pixels = GetPixels(image);
+    unsigned int width = image->This.GetWidth();
+    sf::IntRect area(rect.Left, rect.Top, rect.Width, rect.Height);
+    if (!pixels || !ClipRect(area, width, image->This.GetHeight()))
+        return;
+
+    const sf::Uint8 components[4] = {color.r, color.g, color.b, color.a};
+    for (int y = area.Top; y < area.Top + area.Height; ++y)
+        FillPixels(pixels + (y * width + area.Left) * 4, area.Width, components);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfImage_BlendRect(sfImage* image, sfIntRect rect, sfColor color)
+{
+    CSFML_CHECK(image);
+
+    sf::Uint8* pixels = GetPixels(image);
+    unsigned int width = image->This.GetWidth();
+    sf::IntRect area(rect.Left, rect.Top, rect.Width, rect.Height);
+    if (!pixels || !ClipRect(area, width, image->This.GetHeight()))
+        return;
+
+    const sf::Uint8 components[4] = {color.r, color.g, color.b, color.a};
+    for (int y = area.Top; y < area.Top + area.Height; ++y)
+        BlendColor(pixels + (y * width + area.Left) * 4, components, area.Width);
+}
+
+
+////////////////////////////////////////////////////////////
+sfImage* sfImage_Resize(const sfImage* image, unsigned int width, unsigned int height, sfImageFilter filter, unsigned int threadCount)
+{
+    CSFML_CHECK_RETURN(image, NULL);
+
+    unsigned int sourceWidth = image->This.GetWidth();
+    unsigned int sourceHeight = image->This.GetHeight();
+    if ((sourceWidth == 0) || (sourceHeight == 0) || (width == 0) || (height == 0))
+        return NULL;
+
+    std::vector<sf::Uint8> pixels(width * height * 4);
+    ResamplePixels(image->This.GetPixelsPtr(), sourceWidth, sourceHeight, &pixels[0], width, height, filter, threadCount);
+
+    sfImage* resized = new sfImage;
+    resized->This.Create(width, height, &pixels[0]);
+
+    return resized;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfImage_GenerateMipChain(const sfImage* image, sfImageFilter filter, unsigned int threadCount, sfImage** levels, size_t maxLevels)
+{
+    CSFML_CHECK_RETURN(image, 0);
+    CSFML_CHECK_RETURN(levels, 0);
+
+    // Each level is resampled from the previous one, until 1x1
+    const sfImage* previous = image;
+    size_t count = 0;
+    while (count < maxLevels)
+    {
+        unsigned int width = previous->This.GetWidth();
+        unsigned int height = previous->This.GetHeight();
+        if ((width <= 1) && (height <= 1))
+            break;
+
+        sfImage* level = sfImage_Resize(previous, std::max(width / 2, 1u), std::max(height / 2, 1u), filter, threadCount);
+        if (!level)
+            break;
+
+        levels[count++] = level;
+        previous = level;
+    }
+
+    return count;
 }
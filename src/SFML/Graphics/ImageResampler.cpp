@@ -0,0 +1,378 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/ImageResampler.hpp>
+#include <SFML/System/Thread.hpp>
+#include <SFML/Simd.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+
+namespace
+{
+    // Weights are 16-bits fixed-point numbers with 14 bits of fraction
+    const int Precision = 14;
+    const int Rounding  = 1 << (Precision - 1);
+
+    // Minimum number of destination pixels worth a thread of their own
+    const unsigned int PixelsPerThread = 64 * 1024;
+
+    // Filter functions and their radius
+    double Box(double x)
+    {
+        return ((x > -0.5) && (x <= 0.5)) ? 1.0 : 0.0;
+    }
+
+    double Triangle(double x)
+    {
+        x = std::fabs(x);
+        return x < 1.0 ? 1.0 - x : 0.0;
+    }
+
+    double Sinc(double x)
+    {
+        if (x == 0.0)
+            return 1.0;
+
+        x *= 3.14159265358979323846;
+        return std::sin(x) / x;
+    }
+
+    double Lanczos(double x)
+    {
+        return ((x > -3.0) && (x < 3.0)) ? Sinc(x) * Sinc(x / 3.0) : 0.0;
+    }
+
+    // Contributions of the source pixels to each destination pixel along one axis;
+    // every destination pixel reads the same number of consecutive source pixels
+    struct Weights
+    {
+        unsigned int       Taps;
+        std::vector<int>   First;
+        std::vector<short> Values;
+    };
+
+    void ComputeWeights(Weights& weights, unsigned int sourceSize, unsigned int size, sfImageFilter filter)
+    {
+        double (*function)(double);
+        double radius;
+        switch (filter)
+        {
+            case sfImageFilterBilinear : function = &Triangle; radius = 1.0; break;
+            case sfImageFilterLanczos :  function = &Lanczos;  radius = 3.0; break;
+            default :                    function = &Box;      radius = 0.5; break;
+        }
+
+        // When shrinking, the filter is stretched to cover all the source pixels
+        double scale = static_cast<double>(sourceSize) / size;
+        double stretch = std::max(scale, 1.0);
+        double support = radius * stretch;
+
+        weights.Taps = std::min(static_cast<unsigned int>(std::ceil(support)) * 2 + 1, sourceSize);
+        weights.First.resize(size);
+        weights.Values.assign(size * weights.Taps, 0);
+
+        std::vector<double> values(weights.Taps);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            double center = (i + 0.5) * scale;
+            int first = std::max(static_cast<int>(center - support + 0.5), 0);
+            int last = std::min(static_cast<int>(center + support + 0.5), static_cast<int>(sourceSize));
+            int count = std::min(last - first, static_cast<int>(weights.Taps));
+
+            double total = 0.0;
+            for (int k = 0; k < count; ++k)
+            {
+                values[k] = function((first + k - center + 0.5) / stretch);
+                total += values[k];
+            }
+
+            // Keep the window inside the source, moving the weights accordingly
+            int start = std::min(first, static_cast<int>(sourceSize - weights.Taps));
+            weights.First[i] = start;
+
+            // Normalize the weights, and give the rounding error to the largest one
+            short* fixed = &weights.Values[i * weights.Taps + (first - start)];
+            int sum = 0;
+            int largest = 0;
+            for (int k = 0; k < count; ++k)
+            {
+                double value = (total != 0.0) ? values[k] / total : (k == 0 ? 1.0 : 0.0);
+                fixed[k] = static_cast<short>(std::floor(value * (1 << Precision) + 0.5));
+                sum += fixed[k];
+                if (fixed[k] > fixed[largest])
+                    largest = k;
+            }
+            fixed[largest] = static_cast<short>(fixed[largest] + (1 << Precision) - sum);
+        }
+    }
+
+    // Pack two weights in a 32-bits lane, the first one in the low half; the shift is done
+    // on unsigned values, since left-shifting a negative weight is undefined
+    inline int PackWeights(short first, short second)
+    {
+        unsigned int packed = static_cast<unsigned short>(first) | (static_cast<unsigned int>(static_cast<unsigned short>(second)) << 16);
+        return static_cast<int>(packed);
+    }
+
+    // Convert an accumulated sum back to an 8-bits component
+    inline sf::Uint8 Normalize(int sum)
+    {
+        return static_cast<sf::Uint8>(std::min(std::max((sum + Rounding) >> Precision, 0), 255));
+    }
+
+    // Resample a row of pixels horizontally
+    void ResampleRow(const sf::Uint8* source, sf::Uint8* destination, unsigned int width, const Weights& weights)
+    {
+        const unsigned int taps = weights.Taps;
+
+        for (unsigned int x = 0; x < width; ++x)
+        {
+            const sf::Uint8* pixels = source + weights.First[x] * 4;
+            const short* values = &weights.Values[x * taps];
+            unsigned int k = 0;
+
+        #if defined(CSFML_SIMD_SSE2)
+
+            // Interleave the components of two pixels, and multiply-add them with two weights at once
+            const __m128i zero = _mm_setzero_si128();
+            __m128i sum = _mm_setzero_si128();
+            for (; k + 2 <= taps; k += 2)
+            {
+                __m128i pair = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pixels + k * 4)), zero);
+                pair = _mm_unpacklo_epi16(pair, _mm_srli_si128(pair, 8));
+                __m128i weight = _mm_set1_epi32(PackWeights(values[k], values[k + 1]));
+                sum = _mm_add_epi32(sum, _mm_madd_epi16(pair, weight));
+            }
+            if (k < taps)
+            {
+                int value;
+                std::memcpy(&value, pixels + k * 4, 4);
+                __m128i single = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(value), zero), zero);
+                sum = _mm_add_epi32(sum, _mm_madd_epi16(single, _mm_set1_epi32(values[k] & 0xFFFF)));
+            }
+            sum = _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(Rounding)), Precision);
+            sum = _mm_packus_epi16(_mm_packs_epi32(sum, sum), zero);
+            int result = _mm_cvtsi128_si32(sum);
+            std::memcpy(destination + x * 4, &result, 4);
+
+        #elif defined(CSFML_SIMD_NEON)
+
+            int32x4_t sum = vdupq_n_s32(0);
+            for (; k < taps; ++k)
+            {
+                sf::Uint32 value;
+                std::memcpy(&value, pixels + k * 4, 4);
+                int16x4_t pixel = vreinterpret_s16_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(value)))));
+                sum = vmlal_n_s16(sum, pixel, values[k]);
+            }
+            uint16x4_t narrow = vqrshrun_n_s32(sum, Precision);
+            sf::Uint32 result = vget_lane_u32(vreinterpret_u32_u8(vqmovn_u16(vcombine_u16(narrow, narrow))), 0);
+            std::memcpy(destination + x * 4, &result, 4);
+
+        #else
+
+            int sum[4] = {0, 0, 0, 0};
+            for (; k < taps; ++k)
+            {
+                for (int c = 0; c < 4; ++c)
+                    sum[c] += pixels[k * 4 + c] * values[k];
+            }
+            for (int c = 0; c < 4; ++c)
+                destination[x * 4 + c] = Normalize(sum[c]);
+
+        #endif
+        }
+    }
+
+    // Compute a row of pixels as a weighted sum of rows
+    void ResampleColumns(const sf::Uint8* const* rows, const short* values, unsigned int taps, sf::Uint8* destination, unsigned int width)
+    {
+        const unsigned int size = width * 4;
+        unsigned int i = 0;
+
+    #if defined(CSFML_SIMD_SSE2)
+
+        // 8 components per iteration, two rows at a time interleaved for multiply-add
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 8 <= size; i += 8)
+        {
+            __m128i low = _mm_setzero_si128();
+            __m128i high = _mm_setzero_si128();
+            for (unsigned int k = 0; k < taps; k += 2)
+            {
+                bool pair = k + 1 < taps;
+                __m128i first = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(rows[k] + i));
+                __m128i second = pair ? _mm_loadl_epi64(reinterpret_cast<const __m128i*>(rows[k + 1] + i)) : zero;
+                __m128i weight = _mm_set1_epi32(PackWeights(values[k], pair ? values[k + 1] : 0));
+                __m128i interleaved = _mm_unpacklo_epi8(first, second);
+                low = _mm_add_epi32(low, _mm_madd_epi16(_mm_unpacklo_epi8(interleaved, zero), weight));
+                high = _mm_add_epi32(high, _mm_madd_epi16(_mm_unpackhi_epi8(interleaved, zero), weight));
+            }
+            low = _mm_srai_epi32(_mm_add_epi32(low, _mm_set1_epi32(Rounding)), Precision);
+            high = _mm_srai_epi32(_mm_add_epi32(high, _mm_set1_epi32(Rounding)), Precision);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(_mm_packs_epi32(low, high), zero));
+        }
+
+    #elif defined(CSFML_SIMD_NEON)
+
+        for (; i + 8 <= size; i += 8)
+        {
+            int32x4_t low = vdupq_n_s32(0);
+            int32x4_t high = vdupq_n_s32(0);
+            for (unsigned int k = 0; k < taps; ++k)
+            {
+                int16x8_t components = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(rows[k] + i)));
+                low = vmlal_n_s16(low, vget_low_s16(components), values[k]);
+                high = vmlal_n_s16(high, vget_high_s16(components), values[k]);
+            }
+            vst1_u8(destination + i, vqmovn_u16(vcombine_u16(vqrshrun_n_s32(low, Precision), vqrshrun_n_s32(high, Precision))));
+        }
+
+    #endif
+
+        for (; i < size; ++i)
+        {
+            int sum = 0;
+            for (unsigned int k = 0; k < taps; ++k)
+                sum += rows[k][i] * values[k];
+            destination[i] = Normalize(sum);
+        }
+    }
+
+    // Range of rows resampled by one thread
+    struct ResampleJob
+    {
+        const Weights*   Filter;
+        const sf::Uint8* Source;
+        sf::Uint8*       Destination;
+        unsigned int     SourceWidth;
+        unsigned int     Width;
+        unsigned int     Begin;
+        unsigned int     End;
+        bool             Vertical;
+    };
+
+    void RunJob(ResampleJob* job)
+    {
+        const Weights& weights = *job->Filter;
+
+        if (!job->Vertical)
+        {
+            for (unsigned int y = job->Begin; y < job->End; ++y)
+                ResampleRow(job->Source + y * job->SourceWidth * 4, job->Destination + y * job->Width * 4, job->Width, weights);
+        }
+        else
+        {
+            std::vector<const sf::Uint8*> rows(weights.Taps);
+            for (unsigned int y = job->Begin; y < job->End; ++y)
+            {
+                for (unsigned int k = 0; k < weights.Taps; ++k)
+                    rows[k] = job->Source + (weights.First[y] + k) * job->Width * 4;
+                ResampleColumns(&rows[0], &weights.Values[y * weights.Taps], weights.Taps, job->Destination + y * job->Width * 4, job->Width);
+            }
+        }
+    }
+
+    // Split a pass over the given number of rows across threads
+    void RunPass(const ResampleJob& pass, unsigned int rows, unsigned int threadCount)
+    {
+        unsigned int useful = std::max(rows * pass.Width / PixelsPerThread, 1u);
+        threadCount = std::min(std::min(threadCount, useful), rows);
+
+        std::vector<ResampleJob> jobs(threadCount, pass);
+        for (unsigned int i = 0; i < threadCount; ++i)
+        {
+            jobs[i].Begin = rows * i / threadCount;
+            jobs[i].End = rows * (i + 1) / threadCount;
+        }
+
+        // The calling thread takes the first range
+        std::vector<sf::Thread*> threads;
+        for (unsigned int i = 1; i < threadCount; ++i)
+        {
+            sf::Thread* thread = new sf::Thread(&RunJob, &jobs[i]);
+            threads.push_back(thread);
+            thread->Launch();
+        }
+
+        RunJob(&jobs[0]);
+
+        for (std::vector<sf::Thread*>::iterator it = threads.begin(); it != threads.end(); ++it)
+        {
+            (*it)->Wait();
+            delete *it;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ResamplePixels(const sf::Uint8* source, unsigned int sourceWidth, unsigned int sourceHeight,
+                    sf::Uint8* destination, unsigned int width, unsigned int height,
+                    sfImageFilter filter, unsigned int threadCount)
+{
+    threadCount = std::max(threadCount, 1u);
+
+    if ((width == sourceWidth) && (height == sourceHeight))
+    {
+        std::memcpy(destination, source, width * height * 4);
+        return;
+    }
+
+    // Resample horizontally first, then vertically; skip the passes that don't change the size
+    std::vector<sf::Uint8> intermediate;
+    const sf::Uint8* rows = source;
+    if (width != sourceWidth)
+    {
+        Weights weights;
+        ComputeWeights(weights, sourceWidth, width, filter);
+
+        sf::Uint8* output = destination;
+        if (height != sourceHeight)
+        {
+            intermediate.resize(width * sourceHeight * 4);
+            output = &intermediate[0];
+        }
+
+        ResampleJob pass = {&weights, source, output, sourceWidth, width, 0, 0, false};
+        RunPass(pass, sourceHeight, threadCount);
+        rows = output;
+    }
+
+    if (height != sourceHeight)
+    {
+        Weights weights;
+        ComputeWeights(weights, sourceHeight, height, filter);
+
+        ResampleJob pass = {&weights, rows, destination, width, width, 0, 0, true};
+        RunPass(pass, height, threadCount);
+    }
+}
@@ -0,0 +1,45 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_IMAGERESAMPLER_H
+#define SFML_IMAGERESAMPLER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.h>
+#include <SFML/Config.hpp>
+
+
+////////////////////////////////////////////////////////////
+// Resample an array of 32-bits RGBA pixels to a new size,
+// using up to threadCount threads including the calling one
+////////////////////////////////////////////////////////////
+void ResamplePixels(const sf::Uint8* source, unsigned int sourceWidth, unsigned int sourceHeight,
+                    sf::Uint8* destination, unsigned int width, unsigned int height,
+                    sfImageFilter filter, unsigned int threadCount);
+
+
+#endif // SFML_IMAGERESAMPLER_H
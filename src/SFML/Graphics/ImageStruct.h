@@ -36,7 +36,19 @@
 ////////////////////////////////////////////////////////////
 struct sfImage
 {
+    sfImage() :
+    Locked(false)
+    {
+    }
+
+    sfImage(const sfImage& copy) :
+    This  (copy.This),
+    Locked(false)
+    {
+    }
+
     sf::Image This;
+    bool      Locked;
 };
 
 
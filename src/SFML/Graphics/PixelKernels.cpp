@@ -0,0 +1,389 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/PixelKernels.hpp>
+#include <SFML/Simd.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace
+{
+    // Exact integer division by 255 of a value in [0, 255 * 255]
+    inline unsigned int Divide255(unsigned int value)
+    {
+        return (value + 1 + (value >> 8)) >> 8;
+    }
+
+    // Rounded integer division by 255 of a value in [0, 255 * 255]
+    inline unsigned int RoundDivide255(unsigned int value)
+    {
+        return Divide255(value + 127);
+    }
+
+#if defined(CSFML_SIMD_SSE2)
+
+    // Load a color as 4 identical 32-bits lanes
+    inline __m128i SplatColor(const sf::Uint8* color)
+    {
+        int value;
+        std::memcpy(&value, color, 4);
+        return _mm_set1_epi32(value);
+    }
+
+    // Divide 16-bits lanes in [0, 255 * 255] by 255
+    inline __m128i Divide255(__m128i value)
+    {
+        return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(value, _mm_set1_epi16(1)), _mm_srli_epi16(value, 8)), 8);
+    }
+
+    // Blend two pixels (widened to 16-bits lanes) over two others
+    inline __m128i BlendWide(__m128i destination, __m128i source)
+    {
+        const __m128i rgb = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+        __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(source, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        __m128i inverse = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+
+        // RGB: (src * a + dst * (255 - a)) / 255, alpha: a + dst * (255 - a) / 255
+        __m128i sum = _mm_add_epi16(_mm_mullo_epi16(source, _mm_and_si128(alpha, rgb)), _mm_mullo_epi16(destination, inverse));
+        return _mm_add_epi16(Divide255(sum), _mm_andnot_si128(rgb, alpha));
+    }
+
+#elif defined(CSFML_SIMD_NEON)
+
+    // Divide 16-bits lanes in [0, 255 * 255] by 255
+    inline uint16x8_t Divide255(uint16x8_t value)
+    {
+        return vshrq_n_u16(vaddq_u16(vaddq_u16(value, vdupq_n_u16(1)), vshrq_n_u16(value, 8)), 8);
+    }
+
+    // Blend one component of 8 pixels, given the alpha and inverse alpha of the source
+    inline uint8x8_t BlendComponent(uint8x8_t destination, uint8x8_t source, uint8x8_t alpha, uint8x8_t inverse)
+    {
+        return vmovn_u16(Divide255(vmlal_u8(vmull_u8(source, alpha), destination, inverse)));
+    }
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void MaskPixels(sf::Uint8* pixels, std::size_t count, const sf::Uint8* colorKey, sf::Uint8 alpha)
+{
+    std::size_t i = 0;
+
+#if defined(CSFML_SIMD_SSE2)
+
+    const sf::Uint8 alphaMask[4] = {0, 0, 0, 255};
+    const sf::Uint8 alphaValue[4] = {0, 0, 0, alpha};
+    const __m128i key = SplatColor(colorKey);
+    const __m128i mask = SplatColor(alphaMask);
+    const __m128i value = SplatColor(alphaValue);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i* address = reinterpret_cast<__m128i*>(pixels + i * 4);
+        __m128i source = _mm_loadu_si128(address);
+        __m128i matching = _mm_and_si128(_mm_cmpeq_epi32(source, key), mask);
+        _mm_storeu_si128(address, _mm_or_si128(_mm_andnot_si128(matching, source), _mm_and_si128(matching, value)));
+    }
+
+#elif defined(CSFML_SIMD_NEON)
+
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t source = vld4q_u8(pixels + i * 4);
+        uint8x16_t matching = vandq_u8(vandq_u8(vceqq_u8(source.val[0], vdupq_n_u8(colorKey[0])),
+                                                vceqq_u8(source.val[1], vdupq_n_u8(colorKey[1]))),
+                                       vandq_u8(vceqq_u8(source.val[2], vdupq_n_u8(colorKey[2])),
+                                                vceqq_u8(source.val[3], vdupq_n_u8(colorKey[3]))));
+        source.val[3] = vbslq_u8(matching, vdupq_n_u8(alpha), source.val[3]);
+        vst4q_u8(pixels + i * 4, source);
+    }
+
+#endif
+
+    for (sf::Uint8* pixel = pixels + i * 4; i < count; ++i, pixel += 4)
+    {
+        if (std::memcmp(pixel, colorKey, 4) == 0)
+            pixel[3] = alpha;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ReversePixels(sf::Uint8* pixels, std::size_t count)
+{
+    std::size_t left = 0;
+    std::size_t right = count;
+
+#if defined(CSFML_SIMD_SSE2)
+
+    // Swap blocks of 4 pixels from both ends, reversing each block
+    for (; right - left >= 8; left += 4, right -= 4)
+    {
+        __m128i* first = reinterpret_cast<__m128i*>(pixels + left * 4);
+        __m128i* last = reinterpret_cast<__m128i*>(pixels + (right - 4) * 4);
+        __m128i a = _mm_loadu_si128(first);
+        __m128i b = _mm_loadu_si128(last);
+        _mm_storeu_si128(first, _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 1, 2, 3)));
+        _mm_storeu_si128(last, _mm_shuffle_epi32(a, _MM_SHUFFLE(0, 1, 2, 3)));
+    }
+
+#elif defined(CSFML_SIMD_NEON)
+
+    for (; right - left >= 8; left += 4, right -= 4)
+    {
+        uint32x4_t a = vrev64q_u32(vreinterpretq_u32_u8(vld1q_u8(pixels + left * 4)));
+        uint32x4_t b = vrev64q_u32(vreinterpretq_u32_u8(vld1q_u8(pixels + (right - 4) * 4)));
+        vst1q_u8(pixels + left * 4, vreinterpretq_u8_u32(vcombine_u32(vget_high_u32(b), vget_low_u32(b))));
+        vst1q_u8(pixels + (right - 4) * 4, vreinterpretq_u8_u32(vcombine_u32(vget_high_u32(a), vget_low_u32(a))));
+    }
+
+#endif
+
+    for (; right - left >= 2; ++left, --right)
+        std::swap_ranges(pixels + left * 4, pixels + left * 4 + 4, pixels + (right - 1) * 4);
+}
+
+
+////////////////////////////////////////////////////////////
+void SwapPixels(sf::Uint8* first, sf::Uint8* second, std::size_t count)
+{
+    std::size_t size = count * 4;
+    std::size_t i = 0;
+
+#if defined(CSFML_SIMD_SSE2)
+
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(first + i), b);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(second + i), a);
+    }
+
+#elif defined(CSFML_SIMD_NEON)
+
+    for (; i + 16 <= size; i += 16)
+    {
+        uint8x16_t a = vld1q_u8(first + i);
+        uint8x16_t b = vld1q_u8(second + i);
+        vst1q_u8(first + i, b);
+        vst1q_u8(second + i, a);
+    }
+
+#endif
+
+    std::swap_ranges(first + i, first + size, second + i);
+}
+
+
+////////////////////////////////////////////////////////////
+void BlendPixels(sf::Uint8* destination, const sf::Uint8* source, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if defined(CSFML_SIMD_SSE2)
+
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i* address = reinterpret_cast<__m128i*>(destination + i * 4);
+        __m128i src = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i * 4));
+        __m128i dst = _mm_loadu_si128(address);
+        __m128i low = BlendWide(_mm_unpacklo_epi8(dst, zero), _mm_unpacklo_epi8(src, zero));
+        __m128i high = BlendWide(_mm_unpackhi_epi8(dst, zero), _mm_unpackhi_epi8(src, zero));
+        _mm_storeu_si128(address, _mm_packus_epi16(low, high));
+    }
+
+#elif defined(CSFML_SIMD_NEON)
+
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t src = vld4_u8(source + i * 4);
+        uint8x8x4_t dst = vld4_u8(destination + i * 4);
+        uint8x8_t alpha = src.val[3];
+        uint8x8_t inverse = vmvn_u8(alpha);
+        dst.val[0] = BlendComponent(dst.val[0], src.val[0], alpha, inverse);
+        dst.val[1] = BlendComponent(dst.val[1], src.val[1], alpha, inverse);
+        dst.val[2] = BlendComponent(dst.val[2], src.val[2], alpha, inverse);
+        dst.val[3] = vadd_u8(alpha, vmovn_u16(Divide255(vmull_u8(dst.val[3], inverse))));
+        vst4_u8(destination + i * 4, dst);
+    }
+
+#endif
+
+    for (; i < count; ++i)
+    {
+        const sf::Uint8* src = source + i * 4;
+        sf::Uint8* dst = destination + i * 4;
+        unsigned int alpha = src[3];
+        dst[0] = static_cast<sf::Uint8>(Divide255(src[0] * alpha + dst[0] * (255 - alpha)));
+        dst[1] = static_cast<sf::Uint8>(Divide255(src[1] * alpha + dst[1] * (255 - alpha)));
+        dst[2] = static_cast<sf::Uint8>(Divide255(src[2] * alpha + dst[2] * (255 - alpha)));
+        dst[3] = static_cast<sf::Uint8>(alpha + Divide255(dst[3] * (255 - alpha)));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void BlendColor(sf::Uint8* destination, const sf::Uint8* color, std::size_t count)
+{
+    // Blend a small run of the color repeatedly
+    sf::Uint8 run[64 * 4];
+    FillPixels(run, 64, color);
+
+    for (std::size_t i = 0; i < count; i += 64)
+        BlendPixels(destination + i * 4, run, std::min<std::size_t>(count - i, 64));
+}
+
+
+////////////////////////////////////////////////////////////
+void PremultiplyPixels(sf::Uint8* pixels, std::size_t count)
+{
+    std::size_t i = 0;
+
+#if defined(CSFML_SIMD_SSE2)
+
+    // The alpha component is multiplied by 255, so that it's left unchanged
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgb = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+    const __m128i opaque = _mm_andnot_si128(rgb, _mm_set1_epi16(255));
+    const __m128i half = _mm_set1_epi16(127);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i* address = reinterpret_cast<__m128i*>(pixels + i * 4);
+        __m128i source = _mm_loadu_si128(address);
+        __m128i result[2];
+        for (int j = 0; j < 2; ++j)
+        {
+            __m128i wide = j == 0 ? _mm_unpacklo_epi8(source, zero) : _mm_unpackhi_epi8(source, zero);
+            __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(wide, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+            __m128i factor = _mm_or_si128(_mm_and_si128(alpha, rgb), opaque);
+            result[j] = Divide255(_mm_add_epi16(_mm_mullo_epi16(wide, factor), half));
+        }
+        _mm_storeu_si128(address, _mm_packus_epi16(result[0], result[1]));
+    }
+
+#elif defined(CSFML_SIMD_NEON)
+
+    const uint16x8_t half = vdupq_n_u16(127);
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t source = vld4_u8(pixels + i * 4);
+        for (int c = 0; c < 3; ++c)
+            source.val[c] = vmovn_u16(Divide255(vaddq_u16(vmull_u8(source.val[c], source.val[3]), half)));
+        vst4_u8(pixels + i * 4, source);
+    }
+
+#endif
+
+    for (sf::Uint8* pixel = pixels + i * 4; i < count; ++i, pixel += 4)
+    {
+        pixel[0] = static_cast<sf::Uint8>(RoundDivide255(pixel[0] * pixel[3]));
+        pixel[1] = static_cast<sf::Uint8>(RoundDivide255(pixel[1] * pixel[3]));
+        pixel[2] = static_cast<sf::Uint8>(RoundDivide255(pixel[2] * pixel[3]));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SwizzlePixels(sf::Uint8* pixels, std::size_t count, const unsigned int* order)
+{
+    std::size_t i = 0;
+
+#if defined(CSFML_SIMD_SSE2)
+
+    // Without byte shuffles, move each component with variable shifts of the 32-bits lanes
+    const __m128i byte = _mm_set1_epi32(0xFF);
+    __m128i sourceShifts[4];
+    __m128i destinationShifts[4];
+    for (int c = 0; c < 4; ++c)
+    {
+        sourceShifts[c] = _mm_cvtsi32_si128(order[c] * 8);
+        destinationShifts[c] = _mm_cvtsi32_si128(c * 8);
+    }
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i* address = reinterpret_cast<__m128i*>(pixels + i * 4);
+        __m128i source = _mm_loadu_si128(address);
+        __m128i result = _mm_setzero_si128();
+        for (int c = 0; c < 4; ++c)
+        {
+            __m128i component = _mm_and_si128(_mm_srl_epi32(source, sourceShifts[c]), byte);
+            result = _mm_or_si128(result, _mm_sll_epi32(component, destinationShifts[c]));
+        }
+        _mm_storeu_si128(address, result);
+    }
+
+#elif defined(CSFML_SIMD_NEON)
+
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t source = vld4q_u8(pixels + i * 4);
+        uint8x16x4_t result;
+        for (int c = 0; c < 4; ++c)
+            result.val[c] = source.val[order[c]];
+        vst4q_u8(pixels + i * 4, result);
+    }
+
+#endif
+
+    for (sf::Uint8* pixel = pixels + i * 4; i < count; ++i, pixel += 4)
+    {
+        sf::Uint8 source[4] = {pixel[0], pixel[1], pixel[2], pixel[3]};
+        for (int c = 0; c < 4; ++c)
+            pixel[c] = source[order[c]];
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void FillPixels(sf::Uint8* pixels, std::size_t count, const sf::Uint8* color)
+{
+    std::size_t i = 0;
+
+#if defined(CSFML_SIMD_SSE2)
+
+    const __m128i value = SplatColor(color);
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i * 4), value);
+
+#elif defined(CSFML_SIMD_NEON)
+
+    sf::Uint32 packed;
+    std::memcpy(&packed, color, 4);
+    const uint8x16_t value = vreinterpretq_u8_u32(vdupq_n_u32(packed));
+    for (; i + 4 <= count; i += 4)
+        vst1q_u8(pixels + i * 4, value);
+
+#endif
+
+    for (sf::Uint8* pixel = pixels + i * 4; i < count; ++i, pixel += 4)
+        std::memcpy(pixel, color, 4);
+}
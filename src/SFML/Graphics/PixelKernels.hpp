@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_PIXELKERNELS_H
+#define SFML_PIXELKERNELS_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Vectorized operations on runs of 32-bits RGBA pixels;
+// colors are given as arrays of 4 components
+////////////////////////////////////////////////////////////
+
+// Set the alpha of the pixels equal to a color key
+void MaskPixels(sf::Uint8* pixels, std::size_t count, const sf::Uint8* colorKey, sf::Uint8 alpha);
+
+// Reverse the order of the pixels
+void ReversePixels(sf::Uint8* pixels, std::size_t count);
+
+// Exchange two runs of pixels
+void SwapPixels(sf::Uint8* first, sf::Uint8* second, std::size_t count);
+
+// Blend pixels over others, using the alpha of the source pixels
+void BlendPixels(sf::Uint8* destination, const sf::Uint8* source, std::size_t count);
+
+// Blend a color over pixels, using the alpha of the color
+void BlendColor(sf::Uint8* destination, const sf::Uint8* color, std::size_t count);
+
+// Multiply the RGB components of the pixels by their alpha
+void PremultiplyPixels(sf::Uint8* pixels, std::size_t count);
+
+// Reorder the components of the pixels; order[i] is the source index of component i
+void SwizzlePixels(sf::Uint8* pixels, std::size_t count, const unsigned int* order);
+
+// Set the pixels to a color
+void FillPixels(sf::Uint8* pixels, std::size_t count, const sf::Uint8* color);
+
+
+#endif // SFML_PIXELKERNELS_H
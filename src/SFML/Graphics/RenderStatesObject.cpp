@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderStatesObject.h>
+#include <SFML/Graphics/RenderStatesObjectStruct.h>
+#include <SFML/Graphics/ConvertRenderStates.hpp>
+#include <SFML/Internal.h>
+
+
+////////////////////////////////////////////////////////////
+sfRenderStatesObject* sfRenderStatesObject_Create(const sfRenderStates* states)
+{
+    sfRenderStatesObject* object = new sfRenderStatesObject;
+    object->This = ConvertRenderStates(states);
+
+    return object;
+}
+
+
+////////////////////////////////////////////////////////////
+sfRenderStatesObject* sfRenderStatesObject_Copy(sfRenderStatesObject* states)
+{
+    CSFML_CHECK_RETURN(states, NULL);
+
+    return new sfRenderStatesObject(*states);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderStatesObject_Destroy(sfRenderStatesObject* states)
+{
+    delete states;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderStatesObject_Update(sfRenderStatesObject* states, const sfRenderStates* newStates)
+{
+    CSFML_CHECK(states);
+
+    states->This = ConvertRenderStates(newStates);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderStatesObject_SetTransform(sfRenderStatesObject* states, const sfTransform* transform)
+{
+    CSFML_CHECK(states);
+
+    states->This.Transform = transform ? transform->This : sf::Transform::Identity;
+}
@@ -27,7 +27,11 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Graphics/RenderTexture.h>
 #include <SFML/Graphics/RenderTextureStruct.h>
+#include <SFML/Graphics/CaptureTicketStruct.h>
 #include <SFML/Graphics/SpriteStruct.h>
+#include <SFML/Graphics/SpriteBatchStruct.h>
+#include <SFML/Graphics/DrawCommandListStruct.h>
+#include <SFML/Graphics/TextBatchStruct.h>
 #include <SFML/Graphics/TextStruct.h>
 #include <SFML/Graphics/ShapeStruct.h>
 #include <SFML/Graphics/CircleShapeStruct.h>
@@ -35,6 +39,7 @@
 #include <SFML/Graphics/RectangleShapeStruct.h>
 #include <SFML/Graphics/VertexArrayStruct.h>
 #include <SFML/Graphics/ConvertRenderStates.hpp>
+#include <SFML/Graphics/RenderStatesObjectStruct.h>
 #include <SFML/Internal.h>
 
 
@@ -43,7 +48,7 @@ sfRenderTexture* sfRenderTexture_Create(unsigned int width, unsigned int height,
 {
     sfRenderTexture* renderTexture = new sfRenderTexture;
     renderTexture->This.Create(width, height, depthBuffer == sfTrue);
-    renderTexture->Target = new sfTexture(const_cast<sf::Texture*>(&renderTexture->This.GetTexture()));
+    renderTexture->Target = new sfTexture(const_cast<sf::Texture*>(&renderTexture->This.GetTexture()), true);
     renderTexture->DefaultView.This = renderTexture->This.GetDefaultView();
     renderTexture->CurrentView.This = renderTexture->This.GetView();
 
@@ -204,6 +209,84 @@ CSFML_GRAPHICS_API void sfRenderTexture_DrawPrimitives(sfRenderTexture* renderTe
 }
 
 
+////////////////////////////////////////////////////////////
+void sfRenderTexture_DrawSpriteBatch(sfRenderTexture* renderTexture, const sfSpriteBatch* batch)
+{
+    CSFML_CHECK(renderTexture);
+    CSFML_CHECK(batch);
+
+    batch->Draw(renderTexture->This);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexture_DrawCommandList(sfRenderTexture* renderTexture, const sfDrawCommandList* list)
+{
+    CSFML_CHECK(renderTexture);
+    CSFML_CHECK(list);
+
+    list->Draw(renderTexture->This);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexture_DrawTextBatch(sfRenderTexture* renderTexture, const sfTextBatch* batch, const sfRenderStates* states)
+{
+    CSFML_CHECK(renderTexture);
+    CSFML_CHECK(batch);
+
+    batch->Draw(renderTexture->This, ConvertRenderStates(states));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexture_DrawSpriteWithStateObject(sfRenderTexture* renderTexture, const sfSprite* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderTexture, Draw(object->This, GetRenderStates(states)));
+}
+void sfRenderTexture_DrawTextWithStateObject(sfRenderTexture* renderTexture, const sfText* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderTexture, Draw(object->This, GetRenderStates(states)));
+}
+void sfRenderTexture_DrawShapeWithStateObject(sfRenderTexture* renderTexture, const sfShape* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderTexture, Draw(object->This, GetRenderStates(states)));
+}
+void sfRenderTexture_DrawCircleShapeWithStateObject(sfRenderTexture* renderTexture, const sfCircleShape* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderTexture, Draw(object->This, GetRenderStates(states)));
+}
+void sfRenderTexture_DrawConvexShapeWithStateObject(sfRenderTexture* renderTexture, const sfConvexShape* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderTexture, Draw(object->This, GetRenderStates(states)));
+}
+void sfRenderTexture_DrawRectangleShapeWithStateObject(sfRenderTexture* renderTexture, const sfRectangleShape* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderTexture, Draw(object->This, GetRenderStates(states)));
+}
+void sfRenderTexture_DrawVertexArrayWithStateObject(sfRenderTexture* renderTexture, const sfVertexArray* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderTexture, Draw(object->This, GetRenderStates(states)));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderTexture_DrawPrimitivesWithStateObject(sfRenderTexture* renderTexture,
+                                                   const sfVertex* vertices, unsigned int vertexCount,
+                                                   sfPrimitiveType type, const sfRenderStatesObject* states)
+{
+    CSFML_CALL(renderTexture, Draw(reinterpret_cast<const sf::Vertex*>(vertices), vertexCount,
+               static_cast<sf::PrimitiveType>(type), GetRenderStates(states)));
+}
+
+
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfRenderTexture_PushGLStates(sfRenderTexture* renderTexture)
 {
@@ -234,6 +317,21 @@ const sfTexture* sfRenderTexture_GetTexture(const sfRenderTexture* renderTexture
 }
 
 
+////////////////////////////////////////////////////////////
+sfCaptureTicket* sfRenderTexture_CaptureAsync(sfRenderTexture* renderTexture)
+{
+    CSFML_CHECK_RETURN(renderTexture, NULL);
+
+    if (!renderTexture->This.SetActive(true))
+        return NULL;
+
+    sfCaptureTicket* ticket = new sfCaptureTicket;
+    ticket->ReadFramebuffer(renderTexture->This.GetWidth(), renderTexture->This.GetHeight(), true);
+
+    return ticket;
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfRenderTexture_SetSmooth(sfRenderTexture* renderTexture, sfBool smooth)
 {
@@ -28,7 +28,11 @@
 #include <SFML/Graphics/RenderWindow.h>
 #include <SFML/Graphics/RenderWindowStruct.h>
 #include <SFML/Graphics/ImageStruct.h>
+#include <SFML/Graphics/CaptureTicketStruct.h>
 #include <SFML/Graphics/SpriteStruct.h>
+#include <SFML/Graphics/SpriteBatchStruct.h>
+#include <SFML/Graphics/DrawCommandListStruct.h>
+#include <SFML/Graphics/TextBatchStruct.h>
 #include <SFML/Graphics/TextStruct.h>
 #include <SFML/Graphics/ShapeStruct.h>
 #include <SFML/Graphics/CircleShapeStruct.h>
@@ -36,6 +40,7 @@
 #include <SFML/Graphics/RectangleShapeStruct.h>
 #include <SFML/Graphics/VertexArrayStruct.h>
 #include <SFML/Graphics/ConvertRenderStates.hpp>
+#include <SFML/Graphics/RenderStatesObjectStruct.h>
 #include <SFML/Internal.h>
 #include <SFML/ConvertEvent.h>
 
@@ -393,6 +398,84 @@ CSFML_GRAPHICS_API void sfRenderWindow_DrawPrimitives(sfRenderWindow* renderWind
 }
 
 
+////////////////////////////////////////////////////////////
+void sfRenderWindow_DrawSpriteBatch(sfRenderWindow* renderWindow, const sfSpriteBatch* batch)
+{
+    CSFML_CHECK(renderWindow);
+    CSFML_CHECK(batch);
+
+    batch->Draw(renderWindow->This);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_DrawCommandList(sfRenderWindow* renderWindow, const sfDrawCommandList* list)
+{
+    CSFML_CHECK(renderWindow);
+    CSFML_CHECK(list);
+
+    list->Draw(renderWindow->This);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_DrawTextBatch(sfRenderWindow* renderWindow, const sfTextBatch* batch, const sfRenderStates* states)
+{
+    CSFML_CHECK(renderWindow);
+    CSFML_CHECK(batch);
+
+    batch->Draw(renderWindow->This, ConvertRenderStates(states));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_DrawSpriteWithStateObject(sfRenderWindow* renderWindow, const sfSprite* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderWindow, Draw(object->This, GetRenderStates(states)));
+}
+void sfRenderWindow_DrawTextWithStateObject(sfRenderWindow* renderWindow, const sfText* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderWindow, Draw(object->This, GetRenderStates(states)));
+}
+void sfRenderWindow_DrawShapeWithStateObject(sfRenderWindow* renderWindow, const sfShape* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderWindow, Draw(object->This, GetRenderStates(states)));
+}
+void sfRenderWindow_DrawCircleShapeWithStateObject(sfRenderWindow* renderWindow, const sfCircleShape* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderWindow, Draw(object->This, GetRenderStates(states)));
+}
+void sfRenderWindow_DrawConvexShapeWithStateObject(sfRenderWindow* renderWindow, const sfConvexShape* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderWindow, Draw(object->This, GetRenderStates(states)));
+}
+void sfRenderWindow_DrawRectangleShapeWithStateObject(sfRenderWindow* renderWindow, const sfRectangleShape* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderWindow, Draw(object->This, GetRenderStates(states)));
+}
+void sfRenderWindow_DrawVertexArrayWithStateObject(sfRenderWindow* renderWindow, const sfVertexArray* object, const sfRenderStatesObject* states)
+{
+    CSFML_CHECK(object);
+    CSFML_CALL(renderWindow, Draw(object->This, GetRenderStates(states)));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_DrawPrimitivesWithStateObject(sfRenderWindow* renderWindow,
+                                                  const sfVertex* vertices, unsigned int vertexCount,
+                                                  sfPrimitiveType type, const sfRenderStatesObject* states)
+{
+    CSFML_CALL(renderWindow, Draw(reinterpret_cast<const sf::Vertex*>(vertices), vertexCount,
+               static_cast<sf::PrimitiveType>(type), GetRenderStates(states)));
+}
+
+
 ////////////////////////////////////////////////////////////
 CSFML_GRAPHICS_API void sfRenderWindow_PushGLStates(sfRenderWindow* renderWindow)
 {
@@ -426,3 +509,19 @@ sfImage* sfRenderWindow_Capture(const sfRenderWindow* renderWindow)
 
     return image;
 }
+
+
+////////////////////////////////////////////////////////////
+sfCaptureTicket* sfRenderWindow_CaptureAsync(const sfRenderWindow* renderWindow)
+{
+    CSFML_CHECK_RETURN(renderWindow, NULL);
+
+    if (!renderWindow->This.SetActive())
+        return NULL;
+
+    // The rows of the window's framebuffer are stored bottom-to-top
+    sfCaptureTicket* ticket = new sfCaptureTicket;
+    ticket->ReadFramebuffer(renderWindow->This.GetWidth(), renderWindow->This.GetHeight(), true);
+
+    return ticket;
+}
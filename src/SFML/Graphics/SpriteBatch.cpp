@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/SpriteBatch.h>
+#include <SFML/Graphics/SpriteBatchStruct.h>
+#include <SFML/Graphics/SpriteStruct.h>
+#include <SFML/Graphics/ConvertRenderStates.hpp>
+#include <SFML/Internal.h>
+#include <cstdlib>
+
+
+namespace
+{
+    // Append the four vertices of a sprite, transformed by the given states
+    void AppendSprite(sfSpriteBatch* batch, const sf::Sprite& sprite, const sf::RenderStates& states)
+    {
+        // Like sf::Sprite::Draw, sprites without a texture are not drawn
+        const sf::Texture* texture = sprite.GetTexture();
+        if (!texture)
+            return;
+
+        // Start a new draw call if the states changed since the previous sprite
+        if (batch->Segments.empty() ||
+            (batch->Segments.back().Texture != texture) ||
+            (batch->Segments.back().BlendMode != states.BlendMode) ||
+            (batch->Segments.back().Shader != states.Shader))
+        {
+            sfSpriteBatchSegment segment;
+            segment.Texture = texture;
+            segment.BlendMode = states.BlendMode;
+            segment.Shader = states.Shader;
+            segment.First = static_cast<unsigned int>(batch->Vertices.size());
+            segment.Count = 0;
+            batch->Segments.push_back(segment);
+        }
+
+        // Same layout as the quad built by sf::Sprite
+        sf::Transform transform = states.Transform * sprite.GetTransform();
+        const sf::IntRect& rect = sprite.GetTextureRect();
+        const sf::Color& color = sprite.GetColor();
+
+        float width  = static_cast<float>(std::abs(rect.Width));
+        float height = static_cast<float>(std::abs(rect.Height));
+        float left   = static_cast<float>(rect.Left);
+        float right  = left + rect.Width;
+        float top    = static_cast<float>(rect.Top);
+        float bottom = top + rect.Height;
+
+        batch->Vertices.push_back(sf::Vertex(transform.TransformPoint(0, 0), color, sf::Vector2f(left, top)));
+        batch->Vertices.push_back(sf::Vertex(transform.TransformPoint(0, height), color, sf::Vector2f(left, bottom)));
+        batch->Vertices.push_back(sf::Vertex(transform.TransformPoint(width, height), color, sf::Vector2f(right, bottom)));
+        batch->Vertices.push_back(sf::Vertex(transform.TransformPoint(width, 0), color, sf::Vector2f(right, top)));
+
+        batch->Segments.back().Count += 4;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfSpriteBatch* sfSpriteBatch_Create(void)
+{
+    return new sfSpriteBatch;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSpriteBatch* sfSpriteBatch_Copy(sfSpriteBatch* batch)
+{
+    CSFML_CHECK_RETURN(batch, NULL);
+
+    return new sfSpriteBatch(*batch);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfSpriteBatch_Destroy(sfSpriteBatch* batch)
+{
+    delete batch;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfSpriteBatch_Clear(sfSpriteBatch* batch)
+{
+    CSFML_CHECK(batch);
+
+    batch->Vertices.clear();
+    batch->Segments.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void sfSpriteBatch_AddSprite(sfSpriteBatch* batch, const sfSprite* sprite, const sfRenderStates* states)
+{
+    CSFML_CHECK(batch);
+    CSFML_CHECK(sprite);
+
+    AppendSprite(batch, sprite->This, ConvertRenderStates(states));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfSpriteBatch_AddSprites(sfSpriteBatch* batch, const sfSprite* const* sprites, size_t spriteCount, const sfRenderStates* states)
+{
+    CSFML_CHECK(batch);
+    CSFML_CHECK(sprites);
+
+    // Convert the states only once for the whole array
+    sf::RenderStates sfmlStates = ConvertRenderStates(states);
+
+    batch->Vertices.reserve(batch->Vertices.size() + spriteCount * 4);
+    for (size_t i = 0; i < spriteCount; ++i)
+    {
+        if (sprites[i])
+            AppendSprite(batch, sprites[i]->This, sfmlStates);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfSpriteBatch_GetSpriteCount(const sfSpriteBatch* batch)
+{
+    CSFML_CHECK_RETURN(batch, 0);
+
+    return static_cast<unsigned int>(batch->Vertices.size() / 4);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfSpriteBatch_GetDrawCallCount(const sfSpriteBatch* batch)
+{
+    CSFML_CHECK_RETURN(batch, 0);
+
+    return static_cast<unsigned int>(batch->Segments.size());
+}
@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SPRITEBATCHSTRUCT_H
+#define SFML_SPRITEBATCHSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
+
+
+////////////////////////////////////////////////////////////
+// Range of vertices drawn with the same render states
+////////////////////////////////////////////////////////////
+struct sfSpriteBatchSegment
+{
+    const sf::Texture* Texture;
+    sf::BlendMode      BlendMode;
+    const sf::Shader*  Shader;
+    unsigned int       First;
+    unsigned int       Count;
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfSpriteBatch
+////////////////////////////////////////////////////////////
+struct sfSpriteBatch
+{
+    void Draw(sf::RenderTarget& target) const
+    {
+        for (std::vector<sfSpriteBatchSegment>::const_iterator it = Segments.begin(); it != Segments.end(); ++it)
+        {
+            sf::RenderStates states;
+            states.BlendMode = it->BlendMode;
+            states.Texture = it->Texture;
+            states.Shader = it->Shader;
+
+            target.Draw(&Vertices[it->First], it->Count, sf::Quads, states);
+        }
+    }
+
+    std::vector<sf::Vertex>           Vertices;
+    std::vector<sfSpriteBatchSegment> Segments;
+};
+
+
+#endif // SFML_SPRITEBATCHSTRUCT_H
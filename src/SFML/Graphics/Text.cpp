@@ -29,7 +29,10 @@
 #include <SFML/Graphics/TextStruct.h>
 #include <SFML/Graphics/Font.h>
 #include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Utf.hpp>
 #include <SFML/Internal.h>
+#include <iterator>
+#include <string.h>
 
 
 ////////////////////////////////////////////////////////////
@@ -179,15 +182,44 @@ const sfTransform* sfText_GetInverseTransform(const sfText* text)
 ////////////////////////////////////////////////////////////
 void sfText_SetString(sfText* text, const char* string)
 {
-    CSFML_CALL(text, SetString(string));
+    CSFML_CHECK(text);
+
+    text->This.SetString(string);
+    text->StringDirty = true;
+    text->Utf8Dirty = true;
 }
 
 
 ////////////////////////////////////////////////////////////
 void sfText_SetUnicodeString(sfText* text, const sfUint32* string)
 {
+    CSFML_CHECK(text);
+
     sf::String UTF32Text = string;
-    CSFML_CALL(text, SetString(UTF32Text));
+    text->This.SetString(UTF32Text);
+    text->StringDirty = true;
+    text->Utf8Dirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfText_SetUtf8String(sfText* text, const char* string)
+{
+    CSFML_CHECK(text);
+    CSFML_CHECK(string);
+
+    // Nothing to do if the string didn't change
+    if (!text->Utf8Dirty && (text->Utf8String == string))
+        return;
+
+    std::basic_string<sf::Uint32> UTF32Text;
+    sf::Utf8::ToUtf32(string, string + strlen(string), std::back_inserter(UTF32Text));
+    text->This.SetString(UTF32Text);
+
+    // The UTF-8 version is already known, keep it
+    text->Utf8String = string;
+    text->Utf8Dirty = false;
+    text->StringDirty = true;
 }
 
 
@@ -227,7 +259,11 @@ const char* sfText_GetString(const sfText* text)
 {
     CSFML_CHECK_RETURN(text, NULL);
 
-    text->String = text->This.GetString().ToAnsiString();
+    if (text->StringDirty)
+    {
+        text->String = text->This.GetString().ToAnsiString();
+        text->StringDirty = false;
+    }
 
     return text->String.c_str();
 }
@@ -242,6 +278,23 @@ const sfUint32* sfText_GetUnicodeString(const sfText* text)
 }
 
 
+////////////////////////////////////////////////////////////
+const char* sfText_GetUtf8String(const sfText* text)
+{
+    CSFML_CHECK_RETURN(text, NULL);
+
+    if (text->Utf8Dirty)
+    {
+        const sf::String& string = text->This.GetString();
+        text->Utf8String.clear();
+        sf::Utf32::ToUtf8(string.GetData(), string.GetData() + string.GetSize(), std::back_inserter(text->Utf8String));
+        text->Utf8Dirty = false;
+    }
+
+    return text->Utf8String.c_str();
+}
+
+
 ////////////////////////////////////////////////////////////
 const sfFont* sfText_GetFont(const sfText* text)
 {
@@ -0,0 +1,224 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextBatch.h>
+#include <SFML/Graphics/TextBatchStruct.h>
+#include <SFML/Graphics/FontStruct.h>
+#include <SFML/Graphics/Text.h>
+#include <SFML/System/Utf.hpp>
+#include <SFML/Internal.h>
+#include <iterator>
+#include <string>
+#include <string.h>
+
+
+namespace
+{
+    // Get the group of a batch that matches a font and a character size, creating it if needed
+    sfTextBatchGroup& GetGroup(sfTextBatch* batch, const sf::Font& font, unsigned int characterSize)
+    {
+        for (std::vector<sfTextBatchGroup>::iterator it = batch->Groups.begin(); it != batch->Groups.end(); ++it)
+        {
+            if ((it->Font == &font) && (it->CharacterSize == characterSize))
+                return *it;
+        }
+
+        sfTextBatchGroup group;
+        group.Font = &font;
+        group.CharacterSize = characterSize;
+        batch->Groups.push_back(group);
+
+        return batch->Groups.back();
+    }
+
+    // Lay out a string, the same way sf::Text does
+    void AddString(sfTextBatch* batch, const sf::Uint32* begin, const sf::Uint32* end, const sfFont* font, unsigned int characterSize,
+                   sf::Uint32 style, float originX, float originY, sfColor color)
+    {
+        if (begin == end)
+            return;
+
+        const sf::Font& sfmlFont = font ? font->This : sf::Font::GetDefaultFont();
+        std::vector<sf::Vertex>& vertices = GetGroup(batch, sfmlFont, characterSize).Vertices;
+        sf::Color sfmlColor(color.r, color.g, color.b, color.a);
+
+        bool  bold               = (style & sfTextBold) != 0;
+        bool  underlined         = (style & sfTextUnderlined) != 0;
+        float italic             = (style & sfTextItalic) ? 0.208f : 0.f; // 12 degrees
+        float underlineOffset    = characterSize * 0.1f;
+        float underlineThickness = characterSize * (bold ? 0.1f : 0.07f);
+
+        float hspace = static_cast<float>(sfmlFont.GetGlyph(L' ', characterSize, bold).Advance);
+        float vspace = static_cast<float>(sfmlFont.GetLineSpacing(characterSize));
+        float x      = 0.f;
+        float y      = static_cast<float>(characterSize);
+
+        sf::Uint32 prevChar = 0;
+        for (const sf::Uint32* it = begin; it != end; ++it)
+        {
+            sf::Uint32 curChar = *it;
+
+            // Apply the kerning offset
+            x += static_cast<float>(sfmlFont.GetKerning(prevChar, curChar, characterSize));
+            prevChar = curChar;
+
+            // If we're using the underlined style and there's a new line, draw a line
+            if (underlined && (curChar == L'\n'))
+            {
+                float top = y + underlineOffset;
+                float bottom = top + underlineThickness;
+
+                vertices.push_back(sf::Vertex(sf::Vector2f(originX, originY + top),        sfmlColor, sf::Vector2f(1, 1)));
+                vertices.push_back(sf::Vertex(sf::Vector2f(originX + x, originY + top),    sfmlColor, sf::Vector2f(2, 1)));
+                vertices.push_back(sf::Vertex(sf::Vector2f(originX + x, originY + bottom), sfmlColor, sf::Vector2f(2, 2)));
+                vertices.push_back(sf::Vertex(sf::Vector2f(originX, originY + bottom),     sfmlColor, sf::Vector2f(1, 2)));
+            }
+
+            // Handle special characters
+            switch (curChar)
+            {
+                case L' ' :  x += hspace;        continue;
+                case L'\t' : x += hspace * 4;    continue;
+                case L'\n' : y += vspace; x = 0; continue;
+                case L'\v' : y += vspace * 4;    continue;
+            }
+
+            // Extract the current glyph's description
+            const sf::Glyph& glyph = sfmlFont.GetGlyph(curChar, characterSize, bold);
+
+            float left   = originX + x + glyph.Bounds.Left;
+            float right  = left + glyph.Bounds.Width;
+            float top    = static_cast<float>(glyph.Bounds.Top);
+            float bottom = top + glyph.Bounds.Height;
+
+            float u1 = static_cast<float>(glyph.TextureRect.Left);
+            float v1 = static_cast<float>(glyph.TextureRect.Top);
+            float u2 = static_cast<float>(glyph.TextureRect.Left + glyph.TextureRect.Width);
+            float v2 = static_cast<float>(glyph.TextureRect.Top  + glyph.TextureRect.Height);
+
+            // Add a quad for the current character
+            vertices.push_back(sf::Vertex(sf::Vector2f(left  - italic * top,    originY + y + top),    sfmlColor, sf::Vector2f(u1, v1)));
+            vertices.push_back(sf::Vertex(sf::Vector2f(right - italic * top,    originY + y + top),    sfmlColor, sf::Vector2f(u2, v1)));
+            vertices.push_back(sf::Vertex(sf::Vector2f(right - italic * bottom, originY + y + bottom), sfmlColor, sf::Vector2f(u2, v2)));
+            vertices.push_back(sf::Vertex(sf::Vector2f(left  - italic * bottom, originY + y + bottom), sfmlColor, sf::Vector2f(u1, v2)));
+
+            // Advance to the next character
+            x += glyph.Advance;
+        }
+
+        // If we're using the underlined style, add the last line
+        if (underlined)
+        {
+            float top = y + underlineOffset;
+            float bottom = top + underlineThickness;
+
+            vertices.push_back(sf::Vertex(sf::Vector2f(originX, originY + top),        sfmlColor, sf::Vector2f(1, 1)));
+            vertices.push_back(sf::Vertex(sf::Vector2f(originX + x, originY + top),    sfmlColor, sf::Vector2f(2, 1)));
+            vertices.push_back(sf::Vertex(sf::Vector2f(originX + x, originY + bottom), sfmlColor, sf::Vector2f(2, 2)));
+            vertices.push_back(sf::Vertex(sf::Vector2f(originX, originY + bottom),     sfmlColor, sf::Vector2f(1, 2)));
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfTextBatch* sfTextBatch_Create(void)
+{
+    return new sfTextBatch;
+}
+
+
+////////////////////////////////////////////////////////////
+sfTextBatch* sfTextBatch_Copy(sfTextBatch* batch)
+{
+    CSFML_CHECK_RETURN(batch, NULL);
+
+    return new sfTextBatch(*batch);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTextBatch_Destroy(sfTextBatch* batch)
+{
+    delete batch;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTextBatch_Clear(sfTextBatch* batch)
+{
+    CSFML_CHECK(batch);
+
+    for (std::vector<sfTextBatchGroup>::iterator it = batch->Groups.begin(); it != batch->Groups.end(); ++it)
+        it->Vertices.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTextBatch_AddString(sfTextBatch* batch, const char* string, const sfFont* font, unsigned int characterSize,
+                           sfUint32 style, float x, float y, sfColor color)
+{
+    CSFML_CHECK(batch);
+    CSFML_CHECK(string);
+
+    std::basic_string<sf::Uint32> UTF32Text;
+    sf::Utf8::ToUtf32(string, string + strlen(string), std::back_inserter(UTF32Text));
+
+    AddString(batch, UTF32Text.data(), UTF32Text.data() + UTF32Text.size(), font, characterSize, style, x, y, color);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTextBatch_AddUnicodeString(sfTextBatch* batch, const sfUint32* string, const sfFont* font, unsigned int characterSize,
+                                  sfUint32 style, float x, float y, sfColor color)
+{
+    CSFML_CHECK(batch);
+    CSFML_CHECK(string);
+
+    const sfUint32* end = string;
+    while (*end)
+        ++end;
+
+    AddString(batch, string, end, font, characterSize, style, x, y, color);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfTextBatch_GetDrawCallCount(const sfTextBatch* batch)
+{
+    CSFML_CHECK_RETURN(batch, 0);
+
+    unsigned int count = 0;
+    for (std::vector<sfTextBatchGroup>::const_iterator it = batch->Groups.begin(); it != batch->Groups.end(); ++it)
+    {
+        if (!it->Vertices.empty())
+            count++;
+    }
+
+    return count;
+}
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TEXTBATCHSTRUCT_H
+#define SFML_TEXTBATCHSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
+
+
+////////////////////////////////////////////////////////////
+// Vertices of the strings that share the same glyph texture
+////////////////////////////////////////////////////////////
+struct sfTextBatchGroup
+{
+    const sf::Font*         Font;
+    unsigned int            CharacterSize;
+    std::vector<sf::Vertex> Vertices;
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfTextBatch
+////////////////////////////////////////////////////////////
+struct sfTextBatch
+{
+    void Draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        for (std::vector<sfTextBatchGroup>::const_iterator it = Groups.begin(); it != Groups.end(); ++it)
+        {
+            if (!it->Vertices.empty())
+            {
+                states.Texture = &it->Font->GetTexture(it->CharacterSize);
+                target.Draw(&it->Vertices[0], static_cast<unsigned int>(it->Vertices.size()), sf::Quads, states);
+            }
+        }
+    }
+
+    std::vector<sfTextBatchGroup> Groups;
+};
+
+
+#endif // SFML_TEXTBATCHSTRUCT_H
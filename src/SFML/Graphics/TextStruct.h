@@ -40,9 +40,19 @@
 ////////////////////////////////////////////////////////////
 struct sfText
 {
+    sfText() :
+    Font       (NULL),
+    StringDirty(true),
+    Utf8Dirty  (true)
+    {
+    }
+
     sf::Text            This;
     const sfFont*       Font;
     mutable std::string String;
+    mutable bool        StringDirty;
+    mutable std::string Utf8String;
+    mutable bool        Utf8Dirty;
     mutable sfTransform Transform;
     mutable sfTransform InverseTransform;
 };
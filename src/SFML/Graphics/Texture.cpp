@@ -28,6 +28,7 @@
 #include <SFML/Graphics/Texture.h>
 #include <SFML/Graphics/TextureStruct.h>
 #include <SFML/Graphics/ImageStruct.h>
+#include <SFML/Graphics/CaptureTicketStruct.h>
 #include <SFML/Graphics/RenderWindowStruct.h>
 #include <SFML/Window/WindowStruct.h>
 #include <SFML/Internal.h>
@@ -173,6 +174,19 @@ sfImage* sfTexture_CopyToImage(const sfTexture* texture)
 }
 
 
+////////////////////////////////////////////////////////////
+sfCaptureTicket* sfTexture_CopyToImageAsync(const sfTexture* texture)
+{
+    CSFML_CHECK_RETURN(texture, NULL);
+    CSFML_CHECK_RETURN(texture->This, NULL);
+
+    sfCaptureTicket* ticket = new sfCaptureTicket;
+    ticket->ReadTexture(*texture->This, texture->PixelsFlipped);
+
+    return ticket;
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfTexture_UpdateFromPixels(sfTexture* texture, const sfUint8* pixels, unsigned int width, unsigned int height, unsigned int x, unsigned int y)
 {
@@ -0,0 +1,483 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureAtlas.h>
+#include <SFML/Graphics/TextureAtlasStruct.h>
+#include <SFML/Graphics/ImageStruct.h>
+#include <SFML/Internal.h>
+#include <algorithm>
+
+
+namespace
+{
+    // Maximum size of the buffer used to clear the texture of a page, in bytes
+    const unsigned int ClearBufferSize = 1024 * 1024;
+
+    // Check if a rectangle can be placed on the skyline starting at the given node,
+    // and compute the lowest Y coordinate where it can be placed
+    bool Fits(const sfTextureAtlasPage& page, std::size_t index, int width, int height, int& y)
+    {
+        if (page.Skyline[index].X + width > static_cast<int>(page.Width))
+            return false;
+
+        y = page.Skyline[index].Y;
+        int widthLeft = width;
+        for (std::size_t i = index; widthLeft > 0; ++i)
+        {
+            y = std::max(y, page.Skyline[i].Y);
+            if (y + height > static_cast<int>(page.Height))
+                return false;
+
+            widthLeft -= page.Skyline[i].Width;
+        }
+
+        return true;
+    }
+
+    // Find the best position for a rectangle in a page (bottom-left heuristic)
+    bool FindPosition(const sfTextureAtlasPage& page, int width, int height, std::size_t& index, int& x, int& y)
+    {
+        int bestBottom = -1;
+        int bestWidth = 0;
+        for (std::size_t i = 0; i < page.Skyline.size(); ++i)
+        {
+            int top;
+            if (Fits(page, i, width, height, top))
+            {
+                int bottom = top + height;
+                if ((bestBottom < 0) || (bottom < bestBottom) || ((bottom == bestBottom) && (page.Skyline[i].Width < bestWidth)))
+                {
+                    bestBottom = bottom;
+                    bestWidth = page.Skyline[i].Width;
+                    index = i;
+                    x = page.Skyline[i].X;
+                    y = top;
+                }
+            }
+        }
+
+        return bestBottom >= 0;
+    }
+
+    // Insert a rectangle in the skyline of a page
+    void AddSkylineNode(sfTextureAtlasPage& page, std::size_t index, int x, int y, int width, int height)
+    {
+        sfTextureAtlasNode node = {x, y + height, width};
+        page.Skyline.insert(page.Skyline.begin() + index, node);
+
+        // Shrink or remove the nodes covered by the new one
+        for (std::size_t i = index + 1; i < page.Skyline.size(); ++i)
+        {
+            sfTextureAtlasNode& previous = page.Skyline[i - 1];
+            sfTextureAtlasNode& current = page.Skyline[i];
+            if (current.X >= previous.X + previous.Width)
+                break;
+
+            int shrink = previous.X + previous.Width - current.X;
+            current.X += shrink;
+            current.Width -= shrink;
+            if (current.Width > 0)
+                break;
+
+            page.Skyline.erase(page.Skyline.begin() + i);
+            --i;
+        }
+
+        // Merge the adjacent nodes that have the same height
+        for (std::size_t i = 0; i + 1 < page.Skyline.size(); ++i)
+        {
+            if (page.Skyline[i].Y == page.Skyline[i + 1].Y)
+            {
+                page.Skyline[i].Width += page.Skyline[i + 1].Width;
+                page.Skyline.erase(page.Skyline.begin() + i + 1);
+                --i;
+            }
+        }
+    }
+
+    // Make the skyline of a page empty
+    void ClearSkyline(sfTextureAtlasPage& page)
+    {
+        sfTextureAtlasNode node = {0, 0, static_cast<int>(page.Width)};
+        page.Skyline.assign(1, node);
+    }
+
+    // Enlarge a page without moving what's already in it (the texture is not updated)
+    void GrowPage(sfTextureAtlasPage& page, unsigned int width, unsigned int height)
+    {
+        if (width > page.Width)
+        {
+            sfTextureAtlasNode node = {static_cast<int>(page.Width), 0, static_cast<int>(width - page.Width)};
+            page.Skyline.push_back(node);
+        }
+
+        page.Width = width;
+        page.Height = height;
+    }
+
+    // Find room for a rectangle in the atlas, growing the last page or creating a new one if needed
+    bool Allocate(sfTextureAtlas* atlas, unsigned int width, unsigned int height, unsigned int& pageIndex, int& x, int& y)
+    {
+        unsigned int maximumSize = sf::Texture::GetMaximumSize();
+        if ((width > maximumSize) || (height > maximumSize))
+            return false;
+
+        int w = static_cast<int>(width);
+        int h = static_cast<int>(height);
+        std::size_t index = 0;
+
+        // Try the existing pages first
+        for (pageIndex = 0; pageIndex < atlas->Pages.size(); ++pageIndex)
+        {
+            sfTextureAtlasPage& page = *atlas->Pages[pageIndex];
+            if (FindPosition(page, w, h, index, x, y))
+            {
+                AddSkylineNode(page, index, x, y, w, h);
+                return true;
+            }
+        }
+
+        // Then try to grow the last page
+        if (!atlas->Pages.empty())
+        {
+            pageIndex = static_cast<unsigned int>(atlas->Pages.size() - 1);
+            sfTextureAtlasPage& page = *atlas->Pages.back();
+            while ((page.Width < maximumSize) || (page.Height < maximumSize))
+            {
+                GrowPage(page, std::min(page.Width * 2, maximumSize), std::min(page.Height * 2, maximumSize));
+                if (FindPosition(page, w, h, index, x, y))
+                {
+                    AddSkylineNode(page, index, x, y, w, h);
+                    return true;
+                }
+            }
+        }
+
+        // Finally create a new page, large enough for the rectangle
+        sfTextureAtlasPage* page = new sfTextureAtlasPage;
+        page->Width = std::min(atlas->PageWidth, maximumSize);
+        page->Height = std::min(atlas->PageHeight, maximumSize);
+        while (page->Width < width)
+            page->Width = std::min(page->Width * 2, maximumSize);
+        while (page->Height < height)
+            page->Height = std::min(page->Height * 2, maximumSize);
+        ClearSkyline(*page);
+
+        pageIndex = static_cast<unsigned int>(atlas->Pages.size());
+        atlas->Pages.push_back(page);
+
+        FindPosition(*page, w, h, index, x, y);
+        AddSkylineNode(*page, index, x, y, w, h);
+
+        return true;
+    }
+
+    // Recreate the texture of a page and upload all its entries
+    bool UploadPage(sfTextureAtlas* atlas, unsigned int pageIndex)
+    {
+        sfTextureAtlasPage& page = *atlas->Pages[pageIndex];
+        if (!page.Texture.Create(page.Width, page.Height))
+            return false;
+
+        // The contents of a new texture are undefined, make sure the padding is transparent;
+        // it is cleared by strips of rows, so that large pages don't need a huge buffer
+        unsigned int stripHeight = std::min(std::max(ClearBufferSize / (page.Width * 4), 1u), page.Height);
+        std::vector<sf::Uint8> transparent(page.Width * stripHeight * 4, 0);
+        for (unsigned int y = 0; y < page.Height; y += stripHeight)
+            page.Texture.Update(&transparent[0], page.Width, std::min(stripHeight, page.Height - y), 0, y);
+
+        for (std::vector<sfTextureAtlasEntry>::const_iterator it = atlas->Entries.begin(); it != atlas->Entries.end(); ++it)
+        {
+            if (it->Used && (it->Page == pageIndex))
+                page.Texture.Update(&it->Pixels[0], it->Width, it->Height, it->Rect.Left, it->Rect.Top);
+        }
+
+        return true;
+    }
+
+    // Order used to repack the entries: tallest first, then widest first
+    struct EntryCompare
+    {
+        EntryCompare(const std::vector<sfTextureAtlasEntry>& entries) : Entries(entries) {}
+
+        bool operator ()(std::size_t left, std::size_t right) const
+        {
+            if (Entries[left].Height != Entries[right].Height)
+                return Entries[left].Height > Entries[right].Height;
+
+            return Entries[left].Width > Entries[right].Width;
+        }
+
+        const std::vector<sfTextureAtlasEntry>& Entries;
+    };
+
+    // Check if an identifier refers to a valid entry
+    bool IsValid(const sfTextureAtlas* atlas, int id)
+    {
+        return (id >= 0) && (static_cast<std::size_t>(id) < atlas->Entries.size()) && atlas->Entries[id].Used;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfTextureAtlas* sfTextureAtlas_Create(unsigned int width, unsigned int height, unsigned int padding)
+{
+    sfTextureAtlas* atlas = new sfTextureAtlas;
+    atlas->PageWidth = std::max(width, 1u);
+    atlas->PageHeight = std::max(height, 1u);
+    atlas->Padding = padding;
+
+    return atlas;
+}
+
+
+////////////////////////////////////////////////////////////
+sfTextureAtlas* sfTextureAtlas_Copy(sfTextureAtlas* atlas)
+{
+    CSFML_CHECK_RETURN(atlas, NULL);
+
+    return new sfTextureAtlas(*atlas);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTextureAtlas_Destroy(sfTextureAtlas* atlas)
+{
+    delete atlas;
+}
+
+
+////////////////////////////////////////////////////////////
+int sfTextureAtlas_AddImage(sfTextureAtlas* atlas, const sfImage* image)
+{
+    CSFML_CHECK_RETURN(image, -1);
+
+    return sfTextureAtlas_AddPixels(atlas, image->This.GetPixelsPtr(), image->This.GetWidth(), image->This.GetHeight());
+}
+
+
+////////////////////////////////////////////////////////////
+int sfTextureAtlas_AddPixels(sfTextureAtlas* atlas, const sfUint8* pixels, unsigned int width, unsigned int height)
+{
+    CSFML_CHECK_RETURN(atlas, -1);
+    CSFML_CHECK_RETURN(pixels, -1);
+
+    if ((width == 0) || (height == 0))
+        return -1;
+
+    // Remember the layout of the last page, which is enlarged if there's no room elsewhere
+    std::size_t pageCount = atlas->Pages.size();
+    unsigned int lastWidth = 0;
+    unsigned int lastHeight = 0;
+    std::vector<sfTextureAtlasNode> lastSkyline;
+    if (pageCount > 0)
+    {
+        lastWidth = atlas->Pages.back()->Width;
+        lastHeight = atlas->Pages.back()->Height;
+        lastSkyline = atlas->Pages.back()->Skyline;
+    }
+
+    // Find a place for the entry (and its padding)
+    unsigned int pageIndex;
+    int x, y;
+    if (!Allocate(atlas, width + atlas->Padding, height + atlas->Padding, pageIndex, x, y))
+        return -1;
+
+    sfTextureAtlasEntry entry;
+    entry.Pixels.assign(pixels, pixels + width * height * 4);
+    entry.Width = width;
+    entry.Height = height;
+    entry.Page = pageIndex;
+    entry.Rect = sf::IntRect(x, y, width, height);
+    entry.Used = true;
+    atlas->Entries.push_back(entry);
+
+    // Upload the new entry, or the whole page if it was created or enlarged
+    sfTextureAtlasPage& page = *atlas->Pages[pageIndex];
+    if ((page.Texture.GetWidth() != page.Width) || (page.Texture.GetHeight() != page.Height))
+    {
+        if (!UploadPage(atlas, pageIndex))
+        {
+            // The texture couldn't be created: cancel the insertion, the previous texture is still valid
+            atlas->Entries.pop_back();
+            if (atlas->Pages.size() > pageCount)
+            {
+                delete atlas->Pages.back();
+                atlas->Pages.pop_back();
+            }
+            else
+            {
+                atlas->Pages.back()->Width = lastWidth;
+                atlas->Pages.back()->Height = lastHeight;
+                atlas->Pages.back()->Skyline.swap(lastSkyline);
+            }
+
+            return -1;
+        }
+    }
+    else
+    {
+        page.Texture.Update(pixels, width, height, x, y);
+    }
+
+    return static_cast<int>(atlas->Entries.size() - 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTextureAtlas_Remove(sfTextureAtlas* atlas, int id)
+{
+    CSFML_CHECK(atlas);
+
+    if (IsValid(atlas, id))
+    {
+        sfTextureAtlasEntry& entry = atlas->Entries[id];
+        entry.Used = false;
+        std::vector<sf::Uint8>().swap(entry.Pixels);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfIntRect sfTextureAtlas_GetTextureRect(const sfTextureAtlas* atlas, int id)
+{
+    sfIntRect rect = {0, 0, 0, 0};
+    CSFML_CHECK_RETURN(atlas, rect);
+
+    if (IsValid(atlas, id))
+    {
+        const sf::IntRect& entryRect = atlas->Entries[id].Rect;
+        rect.Left = entryRect.Left;
+        rect.Top = entryRect.Top;
+        rect.Width = entryRect.Width;
+        rect.Height = entryRect.Height;
+    }
+
+    return rect;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfTextureAtlas_GetPage(const sfTextureAtlas* atlas, int id)
+{
+    CSFML_CHECK_RETURN(atlas, 0);
+
+    return IsValid(atlas, id) ? atlas->Entries[id].Page : 0;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfTextureAtlas_GetPageCount(const sfTextureAtlas* atlas)
+{
+    CSFML_CHECK_RETURN(atlas, 0);
+
+    return static_cast<unsigned int>(atlas->Pages.size());
+}
+
+
+////////////////////////////////////////////////////////////
+const sfTexture* sfTextureAtlas_GetTexture(const sfTextureAtlas* atlas, unsigned int page)
+{
+    CSFML_CHECK_RETURN(atlas, NULL);
+
+    return page < atlas->Pages.size() ? &atlas->Pages[page]->View : NULL;
+}
+
+
+////////////////////////////////////////////////////////////
+sfBool sfTextureAtlas_Repack(sfTextureAtlas* atlas)
+{
+    CSFML_CHECK_RETURN(atlas, sfFalse);
+
+    // Sort the entries so that the tallest ones are packed first
+    std::vector<std::size_t> order;
+    for (std::size_t i = 0; i < atlas->Entries.size(); ++i)
+    {
+        if (atlas->Entries[i].Used)
+            order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), EntryCompare(atlas->Entries));
+
+    // Empty the pages, but keep their current size
+    for (std::vector<sfTextureAtlasPage*>::iterator it = atlas->Pages.begin(); it != atlas->Pages.end(); ++it)
+        ClearSkyline(**it);
+
+    // Pack all the entries again
+    bool success = true;
+    std::vector<bool> pageUsed;
+    for (std::vector<std::size_t>::const_iterator it = order.begin(); it != order.end(); ++it)
+    {
+        sfTextureAtlasEntry& entry = atlas->Entries[*it];
+
+        unsigned int pageIndex;
+        int x, y;
+        if (Allocate(atlas, entry.Width + atlas->Padding, entry.Height + atlas->Padding, pageIndex, x, y))
+        {
+            entry.Page = pageIndex;
+            entry.Rect = sf::IntRect(x, y, entry.Width, entry.Height);
+            pageUsed.resize(atlas->Pages.size(), false);
+            pageUsed[pageIndex] = true;
+        }
+        else
+        {
+            success = false;
+        }
+    }
+    pageUsed.resize(atlas->Pages.size(), false);
+
+    // Destroy the pages that are no longer used, and update the page indices of the entries
+    std::vector<unsigned int> newIndices(atlas->Pages.size(), 0);
+    std::vector<sfTextureAtlasPage*> pages;
+    for (std::size_t i = 0; i < atlas->Pages.size(); ++i)
+    {
+        if (pageUsed[i])
+        {
+            newIndices[i] = static_cast<unsigned int>(pages.size());
+            pages.push_back(atlas->Pages[i]);
+        }
+        else
+        {
+            delete atlas->Pages[i];
+        }
+    }
+    atlas->Pages.swap(pages);
+    for (std::vector<sfTextureAtlasEntry>::iterator it = atlas->Entries.begin(); it != atlas->Entries.end(); ++it)
+    {
+        if (it->Used)
+            it->Page = newIndices[it->Page];
+    }
+
+    // Upload the new layout
+    for (std::size_t i = 0; i < atlas->Pages.size(); ++i)
+    {
+        if (!UploadPage(atlas, static_cast<unsigned int>(i)))
+            success = false;
+    }
+
+    return success ? sfTrue : sfFalse;
+}
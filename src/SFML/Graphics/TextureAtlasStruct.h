@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TEXTUREATLASSTRUCT_H
+#define SFML_TEXTUREATLASSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/TextureStruct.h>
+#include <vector>
+
+
+////////////////////////////////////////////////////////////
+// Horizontal segment of the skyline of an atlas page
+////////////////////////////////////////////////////////////
+struct sfTextureAtlasNode
+{
+    int X;
+    int Y;
+    int Width;
+};
+
+
+////////////////////////////////////////////////////////////
+// Texture of an atlas, with its skyline
+////////////////////////////////////////////////////////////
+struct sfTextureAtlasPage
+{
+    sfTextureAtlasPage() :
+    View  (&Texture),
+    Width (0),
+    Height(0)
+    {
+    }
+
+    sf::Texture                     Texture;
+    sfTexture                       View;
+    unsigned int                    Width;
+    unsigned int                    Height;
+    std::vector<sfTextureAtlasNode> Skyline;
+
+private :
+
+    sfTextureAtlasPage(const sfTextureAtlasPage&);
+    sfTextureAtlasPage& operator =(const sfTextureAtlasPage&);
+};
+
+
+////////////////////////////////////////////////////////////
+// Image stored in an atlas
+////////////////////////////////////////////////////////////
+struct sfTextureAtlasEntry
+{
+    std::vector<sf::Uint8> Pixels;
+    unsigned int           Width;
+    unsigned int           Height;
+    unsigned int           Page;
+    sf::IntRect            Rect;
+    bool                   Used;
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfTextureAtlas
+////////////////////////////////////////////////////////////
+struct sfTextureAtlas
+{
+    sfTextureAtlas()
+    {
+    }
+
+    sfTextureAtlas(const sfTextureAtlas& atlas) :
+    PageWidth (atlas.PageWidth),
+    PageHeight(atlas.PageHeight),
+    Padding   (atlas.Padding),
+    Entries   (atlas.Entries)
+    {
+        for (std::vector<sfTextureAtlasPage*>::const_iterator it = atlas.Pages.begin(); it != atlas.Pages.end(); ++it)
+        {
+            sfTextureAtlasPage* page = new sfTextureAtlasPage;
+            page->Texture = (*it)->Texture;
+            page->Width = (*it)->Width;
+            page->Height = (*it)->Height;
+            page->Skyline = (*it)->Skyline;
+            Pages.push_back(page);
+        }
+    }
+
+    ~sfTextureAtlas()
+    {
+        for (std::vector<sfTextureAtlasPage*>::iterator it = Pages.begin(); it != Pages.end(); ++it)
+            delete *it;
+    }
+
+    unsigned int                     PageWidth;
+    unsigned int                     PageHeight;
+    unsigned int                     Padding;
+    std::vector<sfTextureAtlasEntry> Entries;
+    std::vector<sfTextureAtlasPage*> Pages;
+
+private :
+
+    sfTextureAtlas& operator =(const sfTextureAtlas&);
+};
+
+
+#endif // SFML_TEXTUREATLASSTRUCT_H
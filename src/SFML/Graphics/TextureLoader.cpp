@@ -0,0 +1,324 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TextureLoader.h>
+#include <SFML/Graphics/TextureLoaderStruct.h>
+#include <SFML/Graphics/TextureStruct.h>
+#include <SFML/System/Lock.hpp>
+#include <SFML/Internal.h>
+#include <algorithm>
+
+
+namespace
+{
+    // Add a new request to the queue of a loader, and return its identifier
+    unsigned int Enqueue(sfTextureLoader* loader, sfTextureLoadJob* job, const sfIntRect* area)
+    {
+        if (area)
+            job->Area = sf::IntRect(area->Left, area->Top, area->Width, area->Height);
+        job->Status = sfTextureLoadJob::Queued;
+        job->Cancelled = false;
+
+        unsigned int id;
+        sfTextureLoaderWorker* worker = NULL;
+        {
+            sf::Lock lock(loader->Mutex);
+
+            if ((loader->MaxRequests > 0) && (loader->Jobs.size() >= loader->MaxRequests))
+            {
+                delete job;
+                return 0;
+            }
+
+            // Identifiers start at 1 and skip 0 when they wrap around, so that 0 can mean "no request"
+            id = loader->NextId++;
+            if (loader->NextId == 0)
+                loader->NextId = 1;
+
+            loader->Jobs[id] = job;
+            loader->Queue.push_back(job);
+
+            // Wake up a stopped worker, if any, to process the new request
+            if (!loader->IdleWorkers.empty())
+            {
+                worker = loader->IdleWorkers.back();
+                loader->IdleWorkers.pop_back();
+            }
+        }
+
+        // If the worker has just stopped, Launch waits until its thread is finished
+        if (worker)
+            worker->Thread.Launch();
+
+        return id;
+    }
+
+    // Remove a request from a loader; the mutex must be locked
+    void Release(sfTextureLoader* loader, std::map<unsigned int, sfTextureLoadJob*>::iterator it)
+    {
+        sfTextureLoadJob* job = it->second;
+        loader->Jobs.erase(it);
+
+        switch (job->Status)
+        {
+            // Not started yet: just remove it from the queue
+            case sfTextureLoadJob::Queued :
+                loader->Queue.erase(std::find(loader->Queue.begin(), loader->Queue.end(), job));
+                delete job;
+                break;
+
+            // Being decoded: the worker will delete it when it's done
+            case sfTextureLoadJob::Decoding :
+                job->Cancelled = true;
+                break;
+
+            default :
+                delete job;
+                break;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTextureLoaderWorker::Run()
+{
+    Loader->Work(this);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTextureLoader::Work(sfTextureLoaderWorker* worker)
+{
+    for (;;)
+    {
+        // Take the next request in the queue
+        sfTextureLoadJob* job = NULL;
+        {
+            sf::Lock lock(Mutex);
+
+            if (!Running)
+                return;
+
+            // Nothing left to do: stop, and let the next request launch this worker again
+            if (Queue.empty())
+            {
+                IdleWorkers.push_back(worker);
+                return;
+            }
+
+            job = Queue.front();
+            Queue.pop_front();
+            job->Status = sfTextureLoadJob::Decoding;
+        }
+
+        // Decode the image, without holding the lock
+        bool decoded;
+        if (job->Data.empty())
+            decoded = job->Image.LoadFromFile(job->Filename);
+        else
+            decoded = job->Image.LoadFromMemory(&job->Data[0], job->Data.size());
+        std::vector<char>().swap(job->Data);
+
+        sf::Lock lock(Mutex);
+
+        if (job->Cancelled)
+            delete job;
+        else
+            job->Status = decoded ? sfTextureLoadJob::Decoded : sfTextureLoadJob::Failed;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfTextureLoader* sfTextureLoader_Create(unsigned int threadCount, unsigned int maxRequests)
+{
+    sfTextureLoader* loader = new sfTextureLoader;
+    loader->MaxRequests = maxRequests;
+    loader->NextId = 1;
+    loader->Running = true;
+
+    // The workers are launched when requests are added
+    threadCount = std::max(threadCount, 1u);
+    for (unsigned int i = 0; i < threadCount; ++i)
+        loader->Workers.push_back(new sfTextureLoaderWorker(loader));
+    loader->IdleWorkers = loader->Workers;
+
+    return loader;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTextureLoader_Destroy(sfTextureLoader* loader)
+{
+    if (!loader)
+        return;
+
+    // Cancel everything and stop the workers
+    {
+        sf::Lock lock(loader->Mutex);
+        loader->Running = false;
+        while (!loader->Jobs.empty())
+            Release(loader, loader->Jobs.begin());
+    }
+
+    for (std::vector<sfTextureLoaderWorker*>::iterator it = loader->Workers.begin(); it != loader->Workers.end(); ++it)
+    {
+        (*it)->Thread.Wait();
+        delete *it;
+    }
+
+    delete loader;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfTextureLoader_LoadFromFile(sfTextureLoader* loader, const char* filename, const sfIntRect* area)
+{
+    CSFML_CHECK_RETURN(loader, 0);
+    CSFML_CHECK_RETURN(filename, 0);
+
+    sfTextureLoadJob* job = new sfTextureLoadJob;
+    job->Filename = filename;
+
+    return Enqueue(loader, job, area);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfTextureLoader_LoadFromMemory(sfTextureLoader* loader, const void* data, size_t sizeInBytes, const sfIntRect* area)
+{
+    CSFML_CHECK_RETURN(loader, 0);
+    CSFML_CHECK_RETURN(data, 0);
+
+    if (sizeInBytes == 0)
+        return 0;
+
+    sfTextureLoadJob* job = new sfTextureLoadJob;
+    const char* begin = static_cast<const char*>(data);
+    job->Data.assign(begin, begin + sizeInBytes);
+
+    return Enqueue(loader, job, area);
+}
+
+
+////////////////////////////////////////////////////////////
+sfTextureLoadStatus sfTextureLoader_GetStatus(const sfTextureLoader* loader, unsigned int id)
+{
+    CSFML_CHECK_RETURN(loader, sfTextureLoadInvalid);
+
+    sf::Lock lock(loader->Mutex);
+
+    std::map<unsigned int, sfTextureLoadJob*>::const_iterator it = loader->Jobs.find(id);
+    if (it == loader->Jobs.end())
+        return sfTextureLoadInvalid;
+
+    switch (it->second->Status)
+    {
+        case sfTextureLoadJob::Decoded : return sfTextureLoadReady;
+        case sfTextureLoadJob::Failed :  return sfTextureLoadFailed;
+        default :                        return sfTextureLoadPending;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfTexture* sfTextureLoader_GetTexture(sfTextureLoader* loader, unsigned int id)
+{
+    CSFML_CHECK_RETURN(loader, NULL);
+
+    // Take the request out of the loader if it's finished
+    sfTextureLoadJob* job = NULL;
+    {
+        sf::Lock lock(loader->Mutex);
+
+        std::map<unsigned int, sfTextureLoadJob*>::iterator it = loader->Jobs.find(id);
+        if (it == loader->Jobs.end())
+            return NULL;
+
+        if (it->second->Status == sfTextureLoadJob::Failed)
+        {
+            Release(loader, it);
+            return NULL;
+        }
+
+        if (it->second->Status != sfTextureLoadJob::Decoded)
+            return NULL;
+
+        job = it->second;
+        loader->Jobs.erase(it);
+    }
+
+    // Upload the decoded pixels on the calling thread
+    sfTexture* texture = new sfTexture;
+    if (!texture->This->LoadFromImage(job->Image, job->Area))
+    {
+        delete texture;
+        texture = NULL;
+    }
+
+    delete job;
+
+    return texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTextureLoader_Cancel(sfTextureLoader* loader, unsigned int id)
+{
+    CSFML_CHECK(loader);
+
+    sf::Lock lock(loader->Mutex);
+
+    std::map<unsigned int, sfTextureLoadJob*>::iterator it = loader->Jobs.find(id);
+    if (it != loader->Jobs.end())
+        Release(loader, it);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTextureLoader_CancelAll(sfTextureLoader* loader)
+{
+    CSFML_CHECK(loader);
+
+    sf::Lock lock(loader->Mutex);
+
+    while (!loader->Jobs.empty())
+        Release(loader, loader->Jobs.begin());
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfTextureLoader_GetRequestCount(const sfTextureLoader* loader)
+{
+    CSFML_CHECK_RETURN(loader, 0);
+
+    sf::Lock lock(loader->Mutex);
+
+    return static_cast<unsigned int>(loader->Jobs.size());
+}
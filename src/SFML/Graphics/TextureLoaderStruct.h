@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_TEXTURELOADERSTRUCT_H
+#define SFML_TEXTURELOADERSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Thread.hpp>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+
+////////////////////////////////////////////////////////////
+// Asynchronous load request
+////////////////////////////////////////////////////////////
+struct sfTextureLoadJob
+{
+    enum State
+    {
+        Queued,
+        Decoding,
+        Decoded,
+        Failed
+    };
+
+    std::string       Filename;
+    std::vector<char> Data;
+    sf::IntRect       Area;
+    sf::Image         Image;
+    State             Status;
+    bool              Cancelled;
+};
+
+
+////////////////////////////////////////////////////////////
+// Thread decoding the requests of a loader; it stops when
+// the queue is empty, and is launched again by new requests
+////////////////////////////////////////////////////////////
+struct sfTextureLoader;
+struct sfTextureLoaderWorker
+{
+    sfTextureLoaderWorker(sfTextureLoader* loader) :
+    Loader(loader),
+    Thread(&sfTextureLoaderWorker::Run, this)
+    {
+    }
+
+    void Run();
+
+    sfTextureLoader* Loader;
+    sf::Thread       Thread;
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfTextureLoader
+////////////////////////////////////////////////////////////
+struct sfTextureLoader
+{
+    void Work(sfTextureLoaderWorker* worker);
+
+    mutable sf::Mutex                          Mutex;
+    std::deque<sfTextureLoadJob*>              Queue;
+    std::map<unsigned int, sfTextureLoadJob*>  Jobs;
+    std::vector<sfTextureLoaderWorker*>        Workers;
+    std::vector<sfTextureLoaderWorker*>        IdleWorkers;
+    unsigned int                               MaxRequests;
+    unsigned int                               NextId;
+    bool                                       Running;
+};
+
+
+#endif // SFML_TEXTURELOADERSTRUCT_H
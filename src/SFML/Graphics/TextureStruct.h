@@ -40,18 +40,21 @@ struct sfTexture
     {
         This = new sf::Texture;
         OwnInstance = true;
+        PixelsFlipped = false;
     }
 
-    sfTexture(sf::Texture* texture)
+    sfTexture(sf::Texture* texture, bool pixelsFlipped = false)
     {
         This = texture;
         OwnInstance = false;
+        PixelsFlipped = pixelsFlipped;
     }
 
     sfTexture(const sfTexture& texture)
     {
         This = texture.This ? new sf::Texture(*texture.This) : NULL;
         OwnInstance = true;
+        PixelsFlipped = false;
     }
 
     ~sfTexture()
@@ -62,6 +65,7 @@ struct sfTexture
 
     sf::Texture* This;
     bool OwnInstance;
+    bool PixelsFlipped; // rows are stored bottom-to-top (texture of a render texture)
 };
 
 
@@ -28,8 +28,130 @@
 #include <SFML/Graphics/Transform.h>
 #include <SFML/Graphics/TransformStruct.h>
 #include <SFML/Internal.h>
+#include <SFML/Simd.h>
+#include <algorithm>
 
 
+namespace
+{
+    // Transform an array of (x, y) pairs with the given 4x4 matrix
+    void TransformPoints(const float* m, const float* points, float* result, size_t count)
+    {
+        size_t i = 0;
+
+#if defined(CSFML_SIMD_SSE2)
+
+        // Two points per register: (x0, y0, x1, y1)
+        const __m128 a = _mm_setr_ps(m[0], m[1], m[0], m[1]);
+        const __m128 b = _mm_setr_ps(m[4], m[5], m[4], m[5]);
+        const __m128 t = _mm_setr_ps(m[12], m[13], m[12], m[13]);
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128 p = _mm_loadu_ps(points + i * 2);
+            __m128 x = _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 0, 0));
+            __m128 y = _mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 1, 1));
+            _mm_storeu_ps(result + i * 2, _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, x), _mm_mul_ps(b, y)), t));
+        }
+
+#elif defined(CSFML_SIMD_NEON)
+
+        // Four points per iteration, deinterleaved into X and Y registers
+        for (; i + 4 <= count; i += 4)
+        {
+            float32x4x2_t p = vld2q_f32(points + i * 2);
+            float32x4x2_t r;
+            r.val[0] = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[12]), p.val[0], m[0]), p.val[1], m[4]);
+            r.val[1] = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[13]), p.val[0], m[1]), p.val[1], m[5]);
+            vst2q_f32(result + i * 2, r);
+        }
+
+#endif
+
+        // Remaining points (or all of them, without SIMD)
+        for (; i < count; ++i)
+        {
+            float x = points[i * 2];
+            float y = points[i * 2 + 1];
+            result[i * 2]     = m[0] * x + m[4] * y + m[12];
+            result[i * 2 + 1] = m[1] * x + m[5] * y + m[13];
+        }
+    }
+
+    // Transform a rectangle with the given 4x4 matrix, and return its bounding rectangle
+    sfFloatRect TransformRect(const float* m, const sfFloatRect& rect)
+    {
+        float left   = rect.Left;
+        float top    = rect.Top;
+        float right  = rect.Left + rect.Width;
+        float bottom = rect.Top + rect.Height;
+
+        float minX, maxX, minY, maxY;
+
+#if defined(CSFML_SIMD_SSE2)
+
+        // The four corners in one register per coordinate
+        __m128 x = _mm_setr_ps(left, left, right, right);
+        __m128 y = _mm_setr_ps(top, bottom, top, bottom);
+        __m128 tx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[0]), x), _mm_mul_ps(_mm_set1_ps(m[4]), y)), _mm_set1_ps(m[12]));
+        __m128 ty = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[1]), x), _mm_mul_ps(_mm_set1_ps(m[5]), y)), _mm_set1_ps(m[13]));
+
+        // Reduce (x0, x1, x2, x3) and (y0, y1, y2, y3) together
+        __m128 lo = _mm_shuffle_ps(tx, ty, _MM_SHUFFLE(1, 0, 1, 0));
+        __m128 hi = _mm_shuffle_ps(tx, ty, _MM_SHUFFLE(3, 2, 3, 2));
+        __m128 mins = _mm_min_ps(lo, hi);
+        __m128 maxs = _mm_max_ps(lo, hi);
+        mins = _mm_min_ps(mins, _mm_shuffle_ps(mins, mins, _MM_SHUFFLE(2, 3, 0, 1)));
+        maxs = _mm_max_ps(maxs, _mm_shuffle_ps(maxs, maxs, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        float minValues[4], maxValues[4];
+        _mm_storeu_ps(minValues, mins);
+        _mm_storeu_ps(maxValues, maxs);
+        minX = minValues[0];
+        minY = minValues[2];
+        maxX = maxValues[0];
+        maxY = maxValues[2];
+
+#elif defined(CSFML_SIMD_NEON)
+
+        // The four corners in one register per coordinate
+        const float xs[4] = {left, left, right, right};
+        const float ys[4] = {top, bottom, top, bottom};
+        float32x4_t x = vld1q_f32(xs);
+        float32x4_t y = vld1q_f32(ys);
+        float32x4_t tx = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[12]), x, m[0]), y, m[4]);
+        float32x4_t ty = vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m[13]), x, m[1]), y, m[5]);
+
+        // Pairwise reductions: (x01, y01) then (x, y)
+        float32x2_t mins = vpmin_f32(vpmin_f32(vget_low_f32(tx), vget_high_f32(tx)), vpmin_f32(vget_low_f32(ty), vget_high_f32(ty)));
+        float32x2_t maxs = vpmax_f32(vpmax_f32(vget_low_f32(tx), vget_high_f32(tx)), vpmax_f32(vget_low_f32(ty), vget_high_f32(ty)));
+        minX = vget_lane_f32(mins, 0);
+        minY = vget_lane_f32(mins, 1);
+        maxX = vget_lane_f32(maxs, 0);
+        maxY = vget_lane_f32(maxs, 1);
+
+#else
+
+        const float corners[8] = {left, top, left, bottom, right, top, right, bottom};
+        float points[8];
+        TransformPoints(m, corners, points, 4);
+
+        minX = maxX = points[0];
+        minY = maxY = points[1];
+        for (int i = 1; i < 4; ++i)
+        {
+            minX = std::min(minX, points[i * 2]);
+            maxX = std::max(maxX, points[i * 2]);
+            minY = std::min(minY, points[i * 2 + 1]);
+            maxY = std::max(maxY, points[i * 2 + 1]);
+        }
+
+#endif
+
+        sfFloatRect transformed = {minX, minY, maxX - minX, maxY - minY};
+        return transformed;
+    }
+}
+
 ////////////////////////////////////////////////////////////
 sfTransform* sfTransform_Create(void)
 {
@@ -112,6 +234,30 @@ void sfTransform_TransformRect(const sfTransform* transform, sfFloatRect rectang
 }
 
 
+////////////////////////////////////////////////////////////
+void sfTransform_TransformPoints(const sfTransform* transform, const float* points, float* transformedPoints, size_t pointCount)
+{
+    CSFML_CHECK(transform);
+    CSFML_CHECK(points);
+    CSFML_CHECK(transformedPoints);
+
+    TransformPoints(transform->This.GetMatrix(), points, transformedPoints, pointCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransform_TransformRects(const sfTransform* transform, const sfFloatRect* rectangles, sfFloatRect* transformedRectangles, size_t rectangleCount)
+{
+    CSFML_CHECK(transform);
+    CSFML_CHECK(rectangles);
+    CSFML_CHECK(transformedRectangles);
+
+    const float* matrix = transform->This.GetMatrix();
+    for (size_t i = 0; i < rectangleCount; ++i)
+        transformedRectangles[i] = TransformRect(matrix, rectangles[i]);
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfTransform_Combine(sfTransform* transform, const sfTransform* other)
 {
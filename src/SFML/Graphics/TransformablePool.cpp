@@ -0,0 +1,436 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Graphics/TransformablePool.h>
+#include <SFML/Graphics/TransformablePoolStruct.h>
+#include <SFML/Graphics/TransformStruct.h>
+#include <SFML/Internal.h>
+#include <SFML/Simd.h>
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+
+
+namespace
+{
+    // Bring an angle back to the range [0, 360], like sf::Transformable does
+    float NormalizeAngle(float angle)
+    {
+        angle = static_cast<float>(std::fmod(angle, 360.f));
+        if (angle < 0)
+            angle += 360.f;
+
+        return angle;
+    }
+
+    // Compute the matrices of the objects in range [first, first + count - 1], with count <= 4
+    void ComputeTransforms(sfTransformablePool* pool, size_t first, size_t count)
+    {
+        // Gather the components of the block; unused lanes are left at zero
+        float positionX[4] = {0}, positionY[4] = {0};
+        float scaleX[4] = {0}, scaleY[4] = {0};
+        float originX[4] = {0}, originY[4] = {0};
+        float cosine[4] = {0}, sine[4] = {0};
+
+        memcpy(positionX, &pool->PositionX[first], count * sizeof(float));
+        memcpy(positionY, &pool->PositionY[first], count * sizeof(float));
+        memcpy(scaleX, &pool->ScaleX[first], count * sizeof(float));
+        memcpy(scaleY, &pool->ScaleY[first], count * sizeof(float));
+        memcpy(originX, &pool->OriginX[first], count * sizeof(float));
+        memcpy(originY, &pool->OriginY[first], count * sizeof(float));
+        for (size_t i = 0; i < count; ++i)
+        {
+            float angle = -pool->Rotation[first + i] * 3.141592654f / 180.f;
+            cosine[i] = static_cast<float>(std::cos(angle));
+            sine[i] = static_cast<float>(std::sin(angle));
+        }
+
+        // Same formula as sf::Transformable::GetTransform, for 4 objects at once
+        float a00[4], a01[4], a02[4], a10[4], a11[4], a12[4];
+
+#if defined(CSFML_SIMD_SSE2)
+
+        __m128 c = _mm_loadu_ps(cosine);
+        __m128 s = _mm_loadu_ps(sine);
+        __m128 sxc = _mm_mul_ps(_mm_loadu_ps(scaleX), c);
+        __m128 syc = _mm_mul_ps(_mm_loadu_ps(scaleY), c);
+        __m128 sxs = _mm_mul_ps(_mm_loadu_ps(scaleX), s);
+        __m128 sys = _mm_mul_ps(_mm_loadu_ps(scaleY), s);
+        __m128 ox  = _mm_loadu_ps(originX);
+        __m128 oy  = _mm_loadu_ps(originY);
+        __m128 tx  = _mm_sub_ps(_mm_sub_ps(_mm_loadu_ps(positionX), _mm_mul_ps(ox, sxc)), _mm_mul_ps(oy, sys));
+        __m128 ty  = _mm_sub_ps(_mm_add_ps(_mm_loadu_ps(positionY), _mm_mul_ps(ox, sxs)), _mm_mul_ps(oy, syc));
+
+        _mm_storeu_ps(a00, sxc);
+        _mm_storeu_ps(a01, sys);
+        _mm_storeu_ps(a02, tx);
+        _mm_storeu_ps(a10, _mm_sub_ps(_mm_setzero_ps(), sxs));
+        _mm_storeu_ps(a11, syc);
+        _mm_storeu_ps(a12, ty);
+
+#elif defined(CSFML_SIMD_NEON)
+
+        float32x4_t c = vld1q_f32(cosine);
+        float32x4_t s = vld1q_f32(sine);
+        float32x4_t sxc = vmulq_f32(vld1q_f32(scaleX), c);
+        float32x4_t syc = vmulq_f32(vld1q_f32(scaleY), c);
+        float32x4_t sxs = vmulq_f32(vld1q_f32(scaleX), s);
+        float32x4_t sys = vmulq_f32(vld1q_f32(scaleY), s);
+        float32x4_t ox  = vld1q_f32(originX);
+        float32x4_t oy  = vld1q_f32(originY);
+        float32x4_t tx  = vmlsq_f32(vmlsq_f32(vld1q_f32(positionX), ox, sxc), oy, sys);
+        float32x4_t ty  = vmlsq_f32(vmlaq_f32(vld1q_f32(positionY), ox, sxs), oy, syc);
+
+        vst1q_f32(a00, sxc);
+        vst1q_f32(a01, sys);
+        vst1q_f32(a02, tx);
+        vst1q_f32(a10, vnegq_f32(sxs));
+        vst1q_f32(a11, syc);
+        vst1q_f32(a12, ty);
+
+#else
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            float sxc = scaleX[i] * cosine[i];
+            float syc = scaleY[i] * cosine[i];
+            float sxs = scaleX[i] * sine[i];
+            float sys = scaleY[i] * sine[i];
+
+            a00[i] = sxc;
+            a01[i] = sys;
+            a02[i] = positionX[i] - originX[i] * sxc - originY[i] * sys;
+            a10[i] = -sxs;
+            a11[i] = syc;
+            a12[i] = positionY[i] + originX[i] * sxs - originY[i] * syc;
+        }
+
+#endif
+
+        // Scatter the results to the matrices (the last row never changes)
+        for (size_t i = 0; i < count; ++i)
+        {
+            float* matrix = &pool->Matrices[(first + i) * 9];
+            matrix[0] = a00[i];
+            matrix[1] = a01[i];
+            matrix[2] = a02[i];
+            matrix[3] = a10[i];
+            matrix[4] = a11[i];
+            matrix[5] = a12[i];
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfTransformablePool* sfTransformablePool_Create(unsigned int count)
+{
+    sfTransformablePool* pool = new sfTransformablePool;
+    sfTransformablePool_Resize(pool, count);
+
+    return pool;
+}
+
+
+////////////////////////////////////////////////////////////
+sfTransformablePool* sfTransformablePool_Copy(sfTransformablePool* pool)
+{
+    CSFML_CHECK_RETURN(pool, NULL);
+
+    return new sfTransformablePool(*pool);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_Destroy(sfTransformablePool* pool)
+{
+    delete pool;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_Resize(sfTransformablePool* pool, unsigned int count)
+{
+    CSFML_CHECK(pool);
+
+    size_t oldCount = pool->Dirty.size();
+
+    // New objects get the default values, whose transform is the identity
+    pool->PositionX.resize(count, 0.f);
+    pool->PositionY.resize(count, 0.f);
+    pool->Rotation.resize(count, 0.f);
+    pool->ScaleX.resize(count, 1.f);
+    pool->ScaleY.resize(count, 1.f);
+    pool->OriginX.resize(count, 0.f);
+    pool->OriginY.resize(count, 0.f);
+    pool->Dirty.resize(count, 0);
+    pool->Matrices.resize(count * 9);
+
+    static const float identity[9] = {1.f, 0.f, 0.f,
+                                      0.f, 1.f, 0.f,
+                                      0.f, 0.f, 1.f};
+    for (size_t i = oldCount; i < count; ++i)
+        memcpy(&pool->Matrices[i * 9], identity, sizeof(identity));
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfTransformablePool_GetCount(const sfTransformablePool* pool)
+{
+    CSFML_CHECK_RETURN(pool, 0);
+
+    return static_cast<unsigned int>(pool->Dirty.size());
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfTransformablePool_Add(sfTransformablePool* pool)
+{
+    CSFML_CHECK_RETURN(pool, 0);
+
+    unsigned int index = static_cast<unsigned int>(pool->Dirty.size());
+    sfTransformablePool_Resize(pool, index + 1);
+
+    return index;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_Remove(sfTransformablePool* pool, unsigned int index)
+{
+    CSFML_CHECK(pool);
+    if (index >= pool->Dirty.size())
+        return;
+
+    size_t last = pool->Dirty.size() - 1;
+    if (index != last)
+    {
+        pool->PositionX[index] = pool->PositionX[last];
+        pool->PositionY[index] = pool->PositionY[last];
+        pool->Rotation[index]  = pool->Rotation[last];
+        pool->ScaleX[index]    = pool->ScaleX[last];
+        pool->ScaleY[index]    = pool->ScaleY[last];
+        pool->OriginX[index]   = pool->OriginX[last];
+        pool->OriginY[index]   = pool->OriginY[last];
+        pool->Dirty[index]     = pool->Dirty[last];
+        memcpy(&pool->Matrices[index * 9], &pool->Matrices[last * 9], 9 * sizeof(float));
+    }
+
+    sfTransformablePool_Resize(pool, static_cast<unsigned int>(last));
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_SetPosition(sfTransformablePool* pool, unsigned int index, float x, float y)
+{
+    CSFML_CHECK(pool);
+
+    pool->PositionX[index] = x;
+    pool->PositionY[index] = y;
+    pool->Dirty[index] = 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_SetRotation(sfTransformablePool* pool, unsigned int index, float angle)
+{
+    CSFML_CHECK(pool);
+
+    pool->Rotation[index] = NormalizeAngle(angle);
+    pool->Dirty[index] = 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_SetScale(sfTransformablePool* pool, unsigned int index, float factorX, float factorY)
+{
+    CSFML_CHECK(pool);
+
+    pool->ScaleX[index] = factorX;
+    pool->ScaleY[index] = factorY;
+    pool->Dirty[index] = 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_SetOrigin(sfTransformablePool* pool, unsigned int index, float x, float y)
+{
+    CSFML_CHECK(pool);
+
+    pool->OriginX[index] = x;
+    pool->OriginY[index] = y;
+    pool->Dirty[index] = 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_GetPosition(const sfTransformablePool* pool, unsigned int index, float* x, float* y)
+{
+    CSFML_CHECK(pool);
+
+    if (x)
+        *x = pool->PositionX[index];
+    if (y)
+        *y = pool->PositionY[index];
+}
+
+
+////////////////////////////////////////////////////////////
+float sfTransformablePool_GetRotation(const sfTransformablePool* pool, unsigned int index)
+{
+    CSFML_CHECK_RETURN(pool, 0.f);
+
+    return pool->Rotation[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_GetScale(const sfTransformablePool* pool, unsigned int index, float* x, float* y)
+{
+    CSFML_CHECK(pool);
+
+    if (x)
+        *x = pool->ScaleX[index];
+    if (y)
+        *y = pool->ScaleY[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_GetOrigin(const sfTransformablePool* pool, unsigned int index, float* x, float* y)
+{
+    CSFML_CHECK(pool);
+
+    if (x)
+        *x = pool->OriginX[index];
+    if (y)
+        *y = pool->OriginY[index];
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_Move(sfTransformablePool* pool, unsigned int index, float offsetX, float offsetY)
+{
+    CSFML_CHECK(pool);
+
+    pool->PositionX[index] += offsetX;
+    pool->PositionY[index] += offsetY;
+    pool->Dirty[index] = 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_Rotate(sfTransformablePool* pool, unsigned int index, float angle)
+{
+    CSFML_CHECK(pool);
+
+    pool->Rotation[index] = NormalizeAngle(pool->Rotation[index] + angle);
+    pool->Dirty[index] = 1;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_SetPositions(sfTransformablePool* pool, unsigned int first, const float* positions, unsigned int count)
+{
+    CSFML_CHECK(pool);
+    CSFML_CHECK(positions);
+
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        pool->PositionX[first + i] = positions[i * 2];
+        pool->PositionY[first + i] = positions[i * 2 + 1];
+    }
+    if (count > 0)
+        std::fill(pool->Dirty.begin() + first, pool->Dirty.begin() + first + count, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_SetRotations(sfTransformablePool* pool, unsigned int first, const float* angles, unsigned int count)
+{
+    CSFML_CHECK(pool);
+    CSFML_CHECK(angles);
+
+    for (unsigned int i = 0; i < count; ++i)
+        pool->Rotation[first + i] = NormalizeAngle(angles[i]);
+    if (count > 0)
+        std::fill(pool->Dirty.begin() + first, pool->Dirty.begin() + first + count, 1);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int sfTransformablePool_UpdateTransforms(sfTransformablePool* pool)
+{
+    CSFML_CHECK_RETURN(pool, 0);
+
+    // Process the objects by blocks of 4, skipping the blocks that didn't change
+    unsigned int updated = 0;
+    size_t count = pool->Dirty.size();
+    for (size_t first = 0; first < count; first += 4)
+    {
+        size_t blockSize = std::min<size_t>(4, count - first);
+
+        bool dirty = false;
+        for (size_t i = first; i < first + blockSize; ++i)
+        {
+            if (pool->Dirty[i])
+            {
+                pool->Dirty[i] = 0;
+                dirty = true;
+                updated++;
+            }
+        }
+
+        if (dirty)
+            ComputeTransforms(pool, first, blockSize);
+    }
+
+    return updated;
+}
+
+
+////////////////////////////////////////////////////////////
+const float* sfTransformablePool_GetMatrices(const sfTransformablePool* pool)
+{
+    CSFML_CHECK_RETURN(pool, NULL);
+
+    return pool->Matrices.empty() ? NULL : &pool->Matrices[0];
+}
+
+
+////////////////////////////////////////////////////////////
+void sfTransformablePool_GetTransform(const sfTransformablePool* pool, unsigned int index, sfTransform* result)
+{
+    CSFML_CHECK(pool);
+    CSFML_CHECK(result);
+
+    const float* m = &pool->Matrices[index * 9];
+    result->This = sf::Transform(m[0], m[1], m[2],
+                                 m[3], m[4], m[5],
+                                 m[6], m[7], m[8]);
+}
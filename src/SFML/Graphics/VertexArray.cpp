@@ -28,6 +28,34 @@
 #include <SFML/Graphics/VertexArray.h>
 #include <SFML/Graphics/VertexArrayStruct.h>
 #include <SFML/Internal.h>
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <vector>
+
+
+namespace
+{
+    // Get the vertices given by the caller, copied to a temporary array if they
+    // belong to the vertex array itself, since resizing or shifting it would move them
+    const sf::Vertex* GetSource(const sf::VertexArray& vertexArray, const sfVertex* vertices, unsigned int vertexCount, std::vector<sf::Vertex>& copy)
+    {
+        // the cast is safe, sfVertex has to be binary compatible with sf::Vertex
+        const sf::Vertex* source = reinterpret_cast<const sf::Vertex*>(vertices);
+
+        unsigned int count = vertexArray.GetVertexCount();
+        if (count == 0)
+            return source;
+
+        const sf::Vertex* first = &vertexArray[0];
+        std::less<const sf::Vertex*> less;
+        if (less(source, first) || !less(source, first + count))
+            return source;
+
+        copy.assign(source, source + vertexCount);
+        return &copy[0];
+    }
+}
 
 
 ////////////////////////////////////////////////////////////
@@ -70,6 +98,19 @@ sfVertex* sfVertexArray_GetVertex(sfVertexArray* vertexArray, unsigned int index
 }
 
 
+////////////////////////////////////////////////////////////
+sfVertex* sfVertexArray_GetVertices(sfVertexArray* vertexArray)
+{
+    CSFML_CHECK_RETURN(vertexArray, NULL);
+
+    if (vertexArray->This.GetVertexCount() == 0)
+        return NULL;
+
+    // the cast is safe, sfVertex has to be binary compatible with sf::Vertex
+    return reinterpret_cast<sfVertex*>(&vertexArray->This[0]);
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfVertexArray_Clear(sfVertexArray* vertexArray)
 {
@@ -84,6 +125,23 @@ void sfVertexArray_Resize(sfVertexArray* vertexArray, unsigned int vertexCount)
 }
 
 
+////////////////////////////////////////////////////////////
+void sfVertexArray_Reserve(sfVertexArray* vertexArray, unsigned int vertexCount)
+{
+    CSFML_CHECK(vertexArray);
+
+    // sf::VertexArray has no reserve function, but shrinking the array
+    // doesn't release its memory, so growing it then shrinking it back
+    // leaves the requested capacity allocated
+    unsigned int count = vertexArray->This.GetVertexCount();
+    if (vertexCount > count)
+    {
+        vertexArray->This.Resize(vertexCount);
+        vertexArray->This.Resize(count);
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfVertexArray_Append(sfVertexArray* vertexArray, sfVertex vertex)
 {
@@ -92,6 +150,65 @@ void sfVertexArray_Append(sfVertexArray* vertexArray, sfVertex vertex)
 }
 
 
+////////////////////////////////////////////////////////////
+void sfVertexArray_AppendVertices(sfVertexArray* vertexArray, const sfVertex* vertices, unsigned int vertexCount)
+{
+    CSFML_CHECK(vertexArray);
+
+    sfVertexArray_InsertVertices(vertexArray, vertexArray->This.GetVertexCount(), vertices, vertexCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfVertexArray_InsertVertices(sfVertexArray* vertexArray, unsigned int index, const sfVertex* vertices, unsigned int vertexCount)
+{
+    CSFML_CHECK(vertexArray);
+    CSFML_CHECK(vertices);
+
+    if (vertexCount == 0)
+        return;
+
+    unsigned int count = vertexArray->This.GetVertexCount();
+    if (index > count)
+        index = count;
+    if (vertexCount > UINT_MAX - count)
+        return;
+
+    std::vector<sf::Vertex> copy;
+    const sf::Vertex* source = GetSource(vertexArray->This, vertices, vertexCount, copy);
+
+    vertexArray->This.Resize(count + vertexCount);
+
+    sf::Vertex* data = &vertexArray->This[0];
+    if (index < count)
+        std::copy_backward(data + index, data + count, data + count + vertexCount);
+    std::copy(source, source + vertexCount, data + index);
+}
+
+
+////////////////////////////////////////////////////////////
+void sfVertexArray_SetVertices(sfVertexArray* vertexArray, unsigned int index, const sfVertex* vertices, unsigned int vertexCount)
+{
+    CSFML_CHECK(vertexArray);
+    CSFML_CHECK(vertices);
+
+    if (vertexCount == 0)
+        return;
+
+    // Don't let index + vertexCount wrap around
+    if (vertexCount > UINT_MAX - index)
+        return;
+
+    std::vector<sf::Vertex> copy;
+    const sf::Vertex* source = GetSource(vertexArray->This, vertices, vertexCount, copy);
+
+    if (index + vertexCount > vertexArray->This.GetVertexCount())
+        vertexArray->This.Resize(index + vertexCount);
+
+    std::copy(source, source + vertexCount, &vertexArray->This[index]);
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfVertexArray_SetPrimitiveType(sfVertexArray* vertexArray, sfPrimitiveType type)
 {
@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/ByteOrder.hpp>
+#include <SFML/Simd.h>
+#include <cstring>
+
+
+namespace
+{
+    // Tell if the host stores integers in little endian order
+    inline bool IsLittleEndian()
+    {
+        const sf::Uint16 value = 1;
+        sf::Uint8 first;
+        std::memcpy(&first, &value, 1);
+        return first == 1;
+    }
+
+#if defined(CSFML_SIMD_SSE2)
+
+    // Swap the bytes of each 16-bits lane
+    inline __m128i Swap16(__m128i value)
+    {
+        return _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+    }
+
+    // Swap the bytes of each 32-bits lane
+    inline __m128i Swap32(__m128i value)
+    {
+        value = _mm_shufflehi_epi16(_mm_shufflelo_epi16(value, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+        return Swap16(value);
+    }
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+void CopyNetworkOrder16(void* destination, const void* source, std::size_t count)
+{
+    if (!IsLittleEndian())
+    {
+        std::memmove(destination, source, count * 2);
+        return;
+    }
+
+    sf::Uint8* out = static_cast<sf::Uint8*>(destination);
+    const sf::Uint8* in = static_cast<const sf::Uint8*>(source);
+    std::size_t i = 0;
+
+#if defined(CSFML_SIMD_SSE2)
+
+    for (; i + 8 <= count; i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2), Swap16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 2))));
+
+#elif defined(CSFML_SIMD_NEON)
+
+    for (; i + 8 <= count; i += 8)
+        vst1q_u8(out + i * 2, vrev16q_u8(vld1q_u8(in + i * 2)));
+
+#endif
+
+    for (; i < count; ++i)
+    {
+        sf::Uint8 first = in[i * 2];
+        out[i * 2] = in[i * 2 + 1];
+        out[i * 2 + 1] = first;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void CopyNetworkOrder32(void* destination, const void* source, std::size_t count)
+{
+    if (!IsLittleEndian())
+    {
+        std::memmove(destination, source, count * 4);
+        return;
+    }
+
+    sf::Uint8* out = static_cast<sf::Uint8*>(destination);
+    const sf::Uint8* in = static_cast<const sf::Uint8*>(source);
+    std::size_t i = 0;
+
+#if defined(CSFML_SIMD_SSE2)
+
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 4), Swap32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 4))));
+
+#elif defined(CSFML_SIMD_NEON)
+
+    for (; i + 4 <= count; i += 4)
+        vst1q_u8(out + i * 4, vrev32q_u8(vld1q_u8(in + i * 4)));
+
+#endif
+
+    for (; i < count; ++i)
+    {
+        sf::Uint8 value[4] = {in[i * 4 + 3], in[i * 4 + 2], in[i * 4 + 1], in[i * 4]};
+        std::memcpy(out + i * 4, value, 4);
+    }
+}
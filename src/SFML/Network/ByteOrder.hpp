@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_BYTEORDER_H
+#define SFML_BYTEORDER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.hpp>
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Vectorized copies of runs of integers between host and
+// network (big endian) byte orders; the conversion is the
+// same in both directions, and destination may be source
+////////////////////////////////////////////////////////////
+
+// Copy 16-bits values, converting their byte order
+void CopyNetworkOrder16(void* destination, const void* source, std::size_t count);
+
+// Copy 32-bits values, converting their byte order
+void CopyNetworkOrder32(void* destination, const void* source, std::size_t count);
+
+
+#endif // SFML_BYTEORDER_H
@@ -27,7 +27,45 @@
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Packet.h>
 #include <SFML/Network/PacketStruct.h>
+#include <SFML/Network/ByteOrder.hpp>
 #include <SFML/Internal.h>
+#include <cstring>
+#include <vector>
+
+
+namespace
+{
+    // Get the data of the next values to read and move the reading position after them,
+    // or return NULL and invalidate the packet if they are not available
+    const char* ReadValues(sfPacket* packet, std::size_t count, std::size_t valueSize)
+    {
+        if (count > (static_cast<std::size_t>(-1) - packet->ReadPos) / valueSize)
+        {
+            packet->IsValid = false;
+            return NULL;
+        }
+
+        std::size_t size = count * valueSize;
+        if (!packet->CheckSize(size))
+            return NULL;
+
+        const char* data = packet->GetData() + packet->ReadPos;
+        packet->ReadPos += size;
+        return data;
+    }
+
+    // Append values to the end of a packet, and return where they were written
+    char* WriteValues(sfPacket* packet, const void* values, std::size_t size)
+    {
+        packet->MakeOwned();
+
+        std::size_t start = packet->This.GetDataSize();
+        packet->This.Append(values, size);
+
+        // The data of sf::Packet is a non-const std::vector, it can be modified in place
+        return const_cast<char*>(packet->This.GetData()) + start;
+    }
+}
 
 
 ////////////////////////////////////////////////////////////
@@ -42,7 +80,24 @@ sfPacket* sfPacket_Copy(sfPacket* packet)
 {
     CSFML_CHECK_RETURN(packet, NULL);
 
-    return new sfPacket(*packet);
+    sfPacket* copy = new sfPacket(*packet);
+    copy->MakeOwned();
+
+    return copy;
+}
+
+
+////////////////////////////////////////////////////////////
+sfPacket* sfPacket_CreateView(const void* data, size_t sizeInBytes)
+{
+    sfPacket* packet = new sfPacket;
+    if (data && (sizeInBytes > 0))
+    {
+        packet->View = static_cast<const char*>(data);
+        packet->ViewSize = sizeInBytes;
+    }
+
+    return packet;
 }
 
 
@@ -56,35 +111,73 @@ void sfPacket_Destroy(sfPacket* packet)
 ////////////////////////////////////////////////////////////
 void sfPacket_Append(sfPacket* packet, const void* data, size_t sizeInBytes)
 {
-    CSFML_CALL(packet, Append(data, sizeInBytes));
+    CSFML_CHECK(packet);
+
+    if (data && (sizeInBytes > 0))
+        WriteValues(packet, data, sizeInBytes);
 }
 
 
 ////////////////////////////////////////////////////////////
 void sfPacket_Clear(sfPacket* packet)
 {
-    CSFML_CALL(packet, Clear());
+    CSFML_CHECK(packet);
+
+    packet->Clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_Reserve(sfPacket* packet, size_t sizeInBytes)
+{
+    CSFML_CHECK(packet);
+
+    packet->MakeOwned();
+
+    std::size_t size = packet->This.GetDataSize();
+    if ((sizeInBytes <= size) || (sizeInBytes <= packet->Reserved))
+        return;
+
+    // sf::Packet has no function to reserve storage, but clearing it keeps its capacity:
+    // grow it to the requested size once, then restore its contents
+    std::vector<char> buffer(sizeInBytes);
+    if (size > 0)
+        std::memcpy(&buffer[0], packet->This.GetData(), size);
+
+    packet->This.Clear();
+    packet->This.Append(&buffer[0], sizeInBytes);
+    packet->This.Clear();
+    if (size > 0)
+        packet->This.Append(&buffer[0], size);
+
+    packet->Reserved = sizeInBytes;
 }
 
 
 ////////////////////////////////////////////////////////////
 const char* sfPacket_GetData(const sfPacket* packet)
 {
-    CSFML_CALL_RETURN(packet, GetData(), NULL);
+    CSFML_CHECK_RETURN(packet, NULL);
+
+    return packet->GetDataSize() > 0 ? packet->GetData() : NULL;
 }
 
 
 ////////////////////////////////////////////////////////////
 size_t sfPacket_GetDataSize(const sfPacket* packet)
 {
-    CSFML_CALL_RETURN(packet, GetDataSize(), 0);
+    CSFML_CHECK_RETURN(packet, 0);
+
+    return packet->GetDataSize();
 }
 
 
 ////////////////////////////////////////////////////////////
 sfBool sfPacket_EndOfPacket(const sfPacket* packet)
 {
-    CSFML_CALL_RETURN(packet, EndOfPacket(), sfFalse);
+    CSFML_CHECK_RETURN(packet, sfFalse);
+
+    return packet->ReadPos >= packet->GetDataSize() ? sfTrue : sfFalse;
 }
 
 
@@ -92,7 +185,7 @@ sfBool sfPacket_EndOfPacket(const sfPacket* packet)
 sfBool sfPacket_CanRead(const sfPacket* packet)
 {
     CSFML_CHECK_RETURN(packet, sfFalse);
-    return packet->This ? sfTrue : sfFalse;
+    return packet->IsValid ? sfTrue : sfFalse;
 }
 
 
@@ -103,71 +196,148 @@ sfBool sfPacket_ReadBool(sfPacket* packet)
 }
 sfInt8 sfPacket_ReadInt8(sfPacket* packet)
 {
-    CSFML_CHECK_RETURN(packet, sfFalse);
-    sfInt8 value;
-    packet->This >> value;
+    sfInt8 value = 0;
+    sfPacket_ReadInt8Array(packet, &value, 1);
     return value;
 }
 sfUint8 sfPacket_ReadUint8(sfPacket* packet)
 {
-    CSFML_CHECK_RETURN(packet, sfFalse);
-    sfUint8 value;
-    packet->This >> value;
+    sfUint8 value = 0;
+    sfPacket_ReadUint8Array(packet, &value, 1);
     return value;
 }
 sfInt16 sfPacket_ReadInt16(sfPacket* packet)
 {
-    CSFML_CHECK_RETURN(packet, sfFalse);
-    sfInt16 value;
-    packet->This >> value;
+    sfInt16 value = 0;
+    sfPacket_ReadInt16Array(packet, &value, 1);
     return value;
 }
 sfUint16 sfPacket_ReadUint16(sfPacket* packet)
 {
-    CSFML_CHECK_RETURN(packet, sfFalse);
-    sfUint16 value;
-    packet->This >> value;
+    sfUint16 value = 0;
+    sfPacket_ReadUint16Array(packet, &value, 1);
     return value;
 }
 sfInt32 sfPacket_ReadInt32(sfPacket* packet)
 {
-    CSFML_CHECK_RETURN(packet, sfFalse);
-    sfInt32 value;
-    packet->This >> value;
+    sfInt32 value = 0;
+    sfPacket_ReadInt32Array(packet, &value, 1);
     return value;
 }
 sfUint32 sfPacket_ReadUint32(sfPacket* packet)
 {
-    CSFML_CHECK_RETURN(packet, sfFalse);
-    sfUint32 value;
-    packet->This >> value;
+    sfUint32 value = 0;
+    sfPacket_ReadUint32Array(packet, &value, 1);
     return value;
 }
 float sfPacket_ReadFloat(sfPacket* packet)
 {
-    CSFML_CHECK_RETURN(packet, sfFalse);
-    float value;
-    packet->This >> value;
+    float value = 0;
+    sfPacket_ReadFloatArray(packet, &value, 1);
     return value;
 }
 double sfPacket_ReadDouble(sfPacket* packet)
 {
-    CSFML_CHECK_RETURN(packet, sfFalse);
-    double value;
-    packet->This >> value;
+    double value = 0;
+    sfPacket_ReadDoubleArray(packet, &value, 1);
     return value;
 }
 void sfPacket_ReadString(sfPacket* packet, char* string)
 {
     CSFML_CHECK(packet);
-    if (string)
-        packet->This >> string;
+    if (!string)
+        return;
+
+    // Strings are stored as their length (32 bits) followed by their characters
+    sfUint32 length = sfPacket_ReadUint32(packet);
+    const char* data = ReadValues(packet, length, 1);
+    if (packet->IsValid)
+    {
+        if (length > 0)
+            std::memcpy(string, data, length);
+        string[length] = '\0';
+    }
 }
 void sfPacket_ReadWideString(sfPacket* packet, wchar_t* string)
 {
     CSFML_CHECK(packet);
-    if (string)
-        packet->This >> string;
+    if (!string)
+        return;
+
+    // Wide strings are stored as their length (32 bits) followed by their characters (32 bits each)
+    sfUint32 length = sfPacket_ReadUint32(packet);
+    const char* data = ReadValues(packet, length, 4);
+    if (packet->IsValid)
+    {
+        for (sfUint32 i = 0; i < length; ++i)
+        {
+            sfUint32 character;
+            CopyNetworkOrder32(&character, data + i * 4, 1);
+            string[i] = static_cast<wchar_t>(character);
+        }
+        string[length] = L'\0';
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_ReadInt8Array(sfPacket* packet, sfInt8* values, size_t count)
+{
+    sfPacket_ReadUint8Array(packet, reinterpret_cast<sfUint8*>(values), count);
+}
+void sfPacket_ReadUint8Array(sfPacket* packet, sfUint8* values, size_t count)
+{
+    CSFML_CHECK(packet);
+    CSFML_CHECK(values);
+
+    const char* data = ReadValues(packet, count, 1);
+    if (data && (count > 0))
+        std::memcpy(values, data, count);
+}
+void sfPacket_ReadInt16Array(sfPacket* packet, sfInt16* values, size_t count)
+{
+    sfPacket_ReadUint16Array(packet, reinterpret_cast<sfUint16*>(values), count);
+}
+void sfPacket_ReadUint16Array(sfPacket* packet, sfUint16* values, size_t count)
+{
+    CSFML_CHECK(packet);
+    CSFML_CHECK(values);
+
+    const char* data = ReadValues(packet, count, 2);
+    if (data)
+        CopyNetworkOrder16(values, data, count);
+}
+void sfPacket_ReadInt32Array(sfPacket* packet, sfInt32* values, size_t count)
+{
+    sfPacket_ReadUint32Array(packet, reinterpret_cast<sfUint32*>(values), count);
+}
+void sfPacket_ReadUint32Array(sfPacket* packet, sfUint32* values, size_t count)
+{
+    CSFML_CHECK(packet);
+    CSFML_CHECK(values);
+
+    const char* data = ReadValues(packet, count, 4);
+    if (data)
+        CopyNetworkOrder32(values, data, count);
+}
+void sfPacket_ReadFloatArray(sfPacket* packet, float* values, size_t count)
+{
+    CSFML_CHECK(packet);
+    CSFML_CHECK(values);
+
+    // Like SFML, floating point values are stored without conversion
+    const char* data = ReadValues(packet, count, sizeof(float));
+    if (data && (count > 0))
+        std::memcpy(values, data, count * sizeof(float));
+}
+void sfPacket_ReadDoubleArray(sfPacket* packet, double* values, size_t count)
+{
+    CSFML_CHECK(packet);
+    CSFML_CHECK(values);
+
+    const char* data = ReadValues(packet, count, sizeof(double));
+    if (data && (count > 0))
+        std::memcpy(values, data, count * sizeof(double));
 }
 
 
@@ -178,55 +348,114 @@ void sfPacket_WriteBool(sfPacket* packet, sfBool value)
 }
 void sfPacket_WriteInt8(sfPacket* packet, sfInt8 value)
 {
-    CSFML_CHECK(packet);
-    packet->This << value;
+    sfPacket_WriteInt8Array(packet, &value, 1);
 }
 void sfPacket_WriteUint8(sfPacket* packet, sfUint8 value)
 {
-    CSFML_CHECK(packet);
-    packet->This << value;
+    sfPacket_WriteUint8Array(packet, &value, 1);
 }
 void sfPacket_WriteInt16(sfPacket* packet, sfInt16 value)
 {
-    CSFML_CHECK(packet);
-    packet->This << value;
+    sfPacket_WriteInt16Array(packet, &value, 1);
 }
 void sfPacket_WriteUint16(sfPacket* packet, sfUint16 value)
 {
-    CSFML_CHECK(packet);
-    packet->This << value;
+    sfPacket_WriteUint16Array(packet, &value, 1);
 }
 void sfPacket_WriteInt32(sfPacket* packet, sfInt32 value)
 {
-    CSFML_CHECK(packet);
-    packet->This << value;
+    sfPacket_WriteInt32Array(packet, &value, 1);
 }
 void sfPacket_WriteUint32(sfPacket* packet, sfUint32 value)
 {
-    CSFML_CHECK(packet);
-    packet->This << value;
+    sfPacket_WriteUint32Array(packet, &value, 1);
 }
 void sfPacket_WriteFloat(sfPacket* packet, float value)
 {
-    CSFML_CHECK(packet);
-    packet->This << value;
+    sfPacket_WriteFloatArray(packet, &value, 1);
 }
 void sfPacket_WriteDouble(sfPacket* packet, double value)
 {
-    CSFML_CHECK(packet);
-    packet->This << value;
+    sfPacket_WriteDoubleArray(packet, &value, 1);
 }
 void sfPacket_WriteString(sfPacket* packet, const char* string)
 {
     CSFML_CHECK(packet);
 
     if (string)
+    {
+        packet->MakeOwned();
         packet->This << string;
+    }
 }
 void sfPacket_WriteWideString(sfPacket* packet, const wchar_t* string)
 {
     CSFML_CHECK(packet);
 
     if (string)
+    {
+        packet->MakeOwned();
         packet->This << string;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacket_WriteInt8Array(sfPacket* packet, const sfInt8* values, size_t count)
+{
+    sfPacket_WriteUint8Array(packet, reinterpret_cast<const sfUint8*>(values), count);
+}
+void sfPacket_WriteUint8Array(sfPacket* packet, const sfUint8* values, size_t count)
+{
+    CSFML_CHECK(packet);
+    CSFML_CHECK(values);
+
+    if (count > 0)
+        WriteValues(packet, values, count);
+}
+void sfPacket_WriteInt16Array(sfPacket* packet, const sfInt16* values, size_t count)
+{
+    sfPacket_WriteUint16Array(packet, reinterpret_cast<const sfUint16*>(values), count);
+}
+void sfPacket_WriteUint16Array(sfPacket* packet, const sfUint16* values, size_t count)
+{
+    CSFML_CHECK(packet);
+    CSFML_CHECK(values);
+
+    if (count > 0)
+    {
+        char* data = WriteValues(packet, values, count * 2);
+        CopyNetworkOrder16(data, data, count);
+    }
+}
+void sfPacket_WriteInt32Array(sfPacket* packet, const sfInt32* values, size_t count)
+{
+    sfPacket_WriteUint32Array(packet, reinterpret_cast<const sfUint32*>(values), count);
+}
+void sfPacket_WriteUint32Array(sfPacket* packet, const sfUint32* values, size_t count)
+{
+    CSFML_CHECK(packet);
+    CSFML_CHECK(values);
+
+    if (count > 0)
+    {
+        char* data = WriteValues(packet, values, count * 4);
+        CopyNetworkOrder32(data, data, count);
+    }
+}
+void sfPacket_WriteFloatArray(sfPacket* packet, const float* values, size_t count)
+{
+    CSFML_CHECK(packet);
+    CSFML_CHECK(values);
+
+    if (count > 0)
+        WriteValues(packet, values, count * sizeof(float));
+}
+void sfPacket_WriteDoubleArray(sfPacket* packet, const double* values, size_t count)
+{
+    CSFML_CHECK(packet);
+    CSFML_CHECK(values);
+
+    if (count > 0)
+        WriteValues(packet, values, count * sizeof(double));
 }
@@ -0,0 +1,296 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/PacketPool.h>
+#include <SFML/Network/PacketPoolStruct.h>
+#include <SFML/Network/Packet.h>
+#include <SFML/Network/PacketStruct.h>
+#include <SFML/System/Lock.hpp>
+#include <SFML/Config.h>
+#include <SFML/Internal.h>
+#include <algorithm>
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#endif
+
+
+namespace
+{
+    // Maximum number of packets kept in the cache of a thread
+    const size_t CacheSize = 32;
+
+    // Number of packets moved at once between a thread cache and the shared list
+    const size_t BatchSize = 16;
+
+    // Maximum number of thread caches of a pool; the caches of finished threads are
+    // never given back, so the threads that come after use the shared list directly
+    const size_t MaxCaches = 16;
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+
+    long AtomicAdd(volatile long& value, long delta)
+    {
+        return InterlockedExchangeAdd(&value, delta) + delta;
+    }
+
+    long AtomicCompareExchange(volatile long& value, long exchange, long comparand)
+    {
+        return InterlockedCompareExchange(&value, exchange, comparand);
+    }
+
+#else
+
+    long AtomicAdd(volatile long& value, long delta)
+    {
+        return __sync_add_and_fetch(&value, delta);
+    }
+
+    long AtomicCompareExchange(volatile long& value, long exchange, long comparand)
+    {
+        return __sync_val_compare_and_swap(&value, comparand, exchange);
+    }
+
+#endif
+
+    // Count the packets handed out (or given back, with a negative delta), and keep track of the peak
+    void UpdateOutstanding(sfPacketPool* pool, long delta)
+    {
+        long outstanding = AtomicAdd(pool->Outstanding, delta);
+        long peak = AtomicAdd(pool->PeakOutstanding, 0);
+        while (outstanding > peak)
+        {
+            long previous = AtomicCompareExchange(pool->PeakOutstanding, outstanding, peak);
+            if (previous == peak)
+                break;
+            peak = previous;
+        }
+    }
+
+    // Get the cache of the calling thread, create it if needed;
+    // return NULL if all the caches of the pool are taken
+    sfPacketCache* GetCache(sfPacketPool* pool)
+    {
+        sfPacketCache* cache = static_cast<sfPacketCache*>(pool->Cache.GetValue());
+        if (!cache)
+        {
+            sf::Lock lock(pool->Mutex);
+
+            if (pool->Caches.size() >= MaxCaches)
+                return NULL;
+
+            cache = new sfPacketCache;
+            cache->Packets.reserve(CacheSize + 1);
+            pool->Caches.push_back(cache);
+            pool->Cache.SetValue(cache);
+        }
+
+        return cache;
+    }
+
+    // Put a packet in the shared list, or destroy it if the list is full; must be called with the mutex locked
+    void Store(sfPacketPool* pool, sfPacket* packet)
+    {
+        if ((pool->MaxPackets == 0) || (pool->Packets.size() < pool->MaxPackets))
+            pool->Packets.push_back(packet);
+        else
+            delete packet;
+    }
+
+    // Move a batch of packets from the shared list to a cache; must be called with the mutex locked
+    void Refill(sfPacketPool* pool, sfPacketCache* cache)
+    {
+        size_t count = std::min(BatchSize, pool->Packets.size());
+        cache->Packets.insert(cache->Packets.end(), pool->Packets.end() - count, pool->Packets.end());
+        pool->Packets.resize(pool->Packets.size() - count);
+    }
+
+    // Move a batch of packets from a cache to the shared list; must be called with the mutex locked
+    void Flush(sfPacketPool* pool, sfPacketCache* cache)
+    {
+        size_t count = std::min(BatchSize, cache->Packets.size());
+        for (size_t i = cache->Packets.size() - count; i < cache->Packets.size(); ++i)
+            Store(pool, cache->Packets[i]);
+        cache->Packets.resize(cache->Packets.size() - count);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfPacketPool* sfPacketPool_Create(size_t packetCapacity, size_t maxPackets)
+{
+    sfPacketPool* pool = new sfPacketPool;
+    pool->PacketCapacity = packetCapacity;
+    pool->MaxPackets = maxPackets;
+
+    sfPacketPoolStats stats = {0, 0, 0, 0, 0};
+    pool->Stats = stats;
+    pool->Outstanding = 0;
+    pool->PeakOutstanding = 0;
+
+    return pool;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacketPool_Destroy(sfPacketPool* pool)
+{
+    if (!pool)
+        return;
+
+    for (std::vector<sfPacketCache*>::iterator cache = pool->Caches.begin(); cache != pool->Caches.end(); ++cache)
+    {
+        for (std::vector<sfPacket*>::iterator packet = (*cache)->Packets.begin(); packet != (*cache)->Packets.end(); ++packet)
+            delete *packet;
+        delete *cache;
+    }
+
+    for (std::vector<sfPacket*>::iterator packet = pool->Packets.begin(); packet != pool->Packets.end(); ++packet)
+        delete *packet;
+
+    delete pool;
+}
+
+
+////////////////////////////////////////////////////////////
+sfPacket* sfPacketPool_Acquire(sfPacketPool* pool)
+{
+    CSFML_CHECK_RETURN(pool, NULL);
+
+    UpdateOutstanding(pool, 1);
+
+    sfPacketCache* cache = GetCache(pool);
+    if (cache && !cache->Packets.empty())
+    {
+        sfPacket* packet = cache->Packets.back();
+        cache->Packets.pop_back();
+
+        return packet;
+    }
+
+    sfPacket* packet = NULL;
+    {
+        sf::Lock lock(pool->Mutex);
+
+        if (cache)
+        {
+            // Report the largest packet size seen by this thread
+            pool->Stats.PeakDataSize = std::max(pool->Stats.PeakDataSize, cache->PeakDataSize);
+
+            Refill(pool, cache);
+            if (!cache->Packets.empty())
+            {
+                packet = cache->Packets.back();
+                cache->Packets.pop_back();
+            }
+        }
+        else if (!pool->Packets.empty())
+        {
+            // No cache for this thread: take the packet directly from the shared list
+            packet = pool->Packets.back();
+            pool->Packets.pop_back();
+        }
+
+        if (!packet)
+            pool->Stats.Created++;
+    }
+
+    // The pool is empty: create a new packet
+    if (!packet)
+    {
+        packet = new sfPacket;
+        if (pool->PacketCapacity > 0)
+            sfPacket_Reserve(packet, pool->PacketCapacity);
+    }
+
+    return packet;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfPacketPool_Release(sfPacketPool* pool, sfPacket* packet)
+{
+    CSFML_CHECK(pool);
+    CSFML_CHECK(packet);
+
+    UpdateOutstanding(pool, -1);
+
+    size_t dataSize = packet->GetDataSize();
+
+    // Clearing the packet keeps its storage
+    packet->Clear();
+
+    sfPacketCache* cache = GetCache(pool);
+    if (cache)
+    {
+        cache->PeakDataSize = std::max(cache->PeakDataSize, dataSize);
+        cache->Packets.push_back(packet);
+
+        if (cache->Packets.size() > CacheSize)
+        {
+            sf::Lock lock(pool->Mutex);
+
+            pool->Stats.PeakDataSize = std::max(pool->Stats.PeakDataSize, cache->PeakDataSize);
+            Flush(pool, cache);
+        }
+    }
+    else
+    {
+        // No cache for this thread: give the packet directly to the shared list
+        sf::Lock lock(pool->Mutex);
+
+        pool->Stats.PeakDataSize = std::max(pool->Stats.PeakDataSize, dataSize);
+        Store(pool, packet);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfPacketPoolStats sfPacketPool_GetStats(const sfPacketPool* pool)
+{
+    sfPacketPoolStats stats = {0, 0, 0, 0, 0};
+    CSFML_CHECK_RETURN(pool, stats);
+
+    sfPacketPool* shared = const_cast<sfPacketPool*>(pool);
+
+    // Packets released by the caller but not created by the pool may make the count go below zero
+    long outstanding = AtomicAdd(shared->Outstanding, 0);
+    long peakOutstanding = AtomicAdd(shared->PeakOutstanding, 0);
+
+    sf::Lock lock(pool->Mutex);
+
+    stats = pool->Stats;
+    stats.Available = pool->Packets.size();
+    stats.Outstanding = outstanding > 0 ? static_cast<size_t>(outstanding) : 0;
+    stats.PeakOutstanding = static_cast<size_t>(peakOutstanding);
+
+    return stats;
+}
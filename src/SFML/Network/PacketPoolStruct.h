@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_PACKETPOOLSTRUCT_H
+#define SFML_PACKETPOOLSTRUCT_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/PacketPool.h>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/ThreadLocal.hpp>
+#include <vector>
+
+
+////////////////////////////////////////////////////////////
+// Packets cached by a thread; only accessed by its thread
+// (and by the pool when it is destroyed)
+////////////////////////////////////////////////////////////
+struct sfPacketCache
+{
+    sfPacketCache() :
+    PeakDataSize(0)
+    {
+    }
+
+    std::vector<sfPacket*> Packets;
+    size_t                 PeakDataSize;
+};
+
+
+////////////////////////////////////////////////////////////
+// Internal structure of sfPacketPool
+////////////////////////////////////////////////////////////
+struct sfPacketPool
+{
+    size_t                      PacketCapacity;
+    size_t                      MaxPackets;
+    sf::ThreadLocal             Cache;
+    mutable sf::Mutex           Mutex;
+    std::vector<sfPacket*>      Packets;
+    std::vector<sfPacketCache*> Caches;
+    sfPacketPoolStats           Stats;
+    volatile long               Outstanding;
+    volatile long               PeakOutstanding;
+};
+
+
+#endif // SFML_PACKETPOOLSTRUCT_H
@@ -29,14 +29,83 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Network/Packet.hpp>
+#include <cstddef>
 
 
 ////////////////////////////////////////////////////////////
 // Internal structure of sfPacket
+//
+// The data is either owned by This, or borrowed from the
+// caller (View) until the packet is modified. The reading
+// position is tracked here rather than by sf::Packet, so
+// that reads can access the data directly.
 ////////////////////////////////////////////////////////////
 struct sfPacket
 {
-    sf::Packet This;
+    sfPacket() :
+    View    (NULL),
+    ViewSize(0),
+    ReadPos (0),
+    IsValid (true),
+    Reserved(0)
+    {
+    }
+
+    sfPacket(const sfPacket& copy) :
+    This    (copy.This),
+    View    (copy.View),
+    ViewSize(copy.ViewSize),
+    ReadPos (copy.ReadPos),
+    IsValid (copy.IsValid),
+    Reserved(0)
+    {
+    }
+
+    const char* GetData() const
+    {
+        return View ? View : This.GetData();
+    }
+
+    std::size_t GetDataSize() const
+    {
+        return View ? ViewSize : This.GetDataSize();
+    }
+
+    // Copy the borrowed data, if any, so that the packet can be modified
+    void MakeOwned()
+    {
+        if (View)
+        {
+            const char* view = View;
+            View = NULL;
+            This.Clear();
+            This.Append(view, ViewSize);
+        }
+    }
+
+    // Clear the packet and its reading state
+    void Clear()
+    {
+        View = NULL;
+        ViewSize = 0;
+        ReadPos = 0;
+        IsValid = true;
+        This.Clear();
+    }
+
+    // Check that the given number of bytes can be read
+    bool CheckSize(std::size_t size)
+    {
+        IsValid = IsValid && (ReadPos + size <= GetDataSize());
+        return IsValid;
+    }
+
+    sf::Packet  This;
+    const char* View;
+    std::size_t ViewSize;
+    std::size_t ReadPos;
+    bool        IsValid;
+    std::size_t Reserved;
 };
 
 
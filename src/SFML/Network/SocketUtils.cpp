@@ -0,0 +1,265 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/SocketUtils.hpp>
+#include <SFML/Config.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <winsock2.h>
+#else
+    #include <sys/socket.h>
+    #include <sys/uio.h>
+    #include <netinet/in.h>
+    #include <arpa/inet.h>
+    #include <errno.h>
+#endif
+
+
+namespace
+{
+    // Number of buffers given to a single system call on a stream socket
+    const size_t MaxBuffers = 64;
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+
+    typedef WSABUF Buffer;
+
+    void SetBuffer(Buffer& buffer, const void* data, size_t size)
+    {
+        buffer.buf = static_cast<CHAR*>(const_cast<void*>(data));
+        buffer.len = static_cast<ULONG>(size);
+    }
+
+    const char* GetData(const Buffer& buffer) {return buffer.buf;}
+    size_t GetSize(const Buffer& buffer) {return buffer.len;}
+
+    // Send buffers with one system call, return the number of bytes sent or -1
+    long SendOnce(sf::SocketHandle handle, Buffer* buffers, size_t count, const sockaddr_in* destination)
+    {
+        DWORD sent = 0;
+        int result;
+        if (destination)
+            result = WSASendTo(handle, buffers, static_cast<DWORD>(count), &sent, 0, reinterpret_cast<const sockaddr*>(destination), sizeof(sockaddr_in), NULL, NULL);
+        else
+            result = WSASend(handle, buffers, static_cast<DWORD>(count), &sent, 0, NULL, NULL);
+
+        return result == SOCKET_ERROR ? -1 : static_cast<long>(sent);
+    }
+
+#else
+
+    typedef iovec Buffer;
+
+    void SetBuffer(Buffer& buffer, const void* data, size_t size)
+    {
+        buffer.iov_base = const_cast<void*>(data);
+        buffer.iov_len = size;
+    }
+
+    const char* GetData(const Buffer& buffer) {return static_cast<const char*>(buffer.iov_base);}
+    size_t GetSize(const Buffer& buffer) {return buffer.iov_len;}
+
+    // Send buffers with one system call, return the number of bytes sent or -1
+    long SendOnce(sf::SocketHandle handle, Buffer* buffers, size_t count, const sockaddr_in* destination)
+    {
+        msghdr message;
+        std::memset(&message, 0, sizeof(message));
+        message.msg_name = const_cast<sockaddr_in*>(destination);
+        message.msg_namelen = destination ? sizeof(sockaddr_in) : 0;
+        message.msg_iov = buffers;
+        message.msg_iovlen = count;
+
+        // Like SFML, don't raise SIGPIPE when the peer is disconnected
+        int flags = 0;
+        #ifdef MSG_NOSIGNAL
+            flags = MSG_NOSIGNAL;
+        #endif
+
+        return static_cast<long>(sendmsg(handle, &message, flags));
+    }
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus GetSocketErrorStatus()
+{
+#if defined(CSFML_SYSTEM_WINDOWS)
+
+    switch (WSAGetLastError())
+    {
+        case WSAEWOULDBLOCK :  return sfSocketNotReady;
+        case WSAEALREADY :     return sfSocketNotReady;
+        case WSAECONNABORTED : return sfSocketDisconnected;
+        case WSAECONNRESET :   return sfSocketDisconnected;
+        case WSAETIMEDOUT :    return sfSocketDisconnected;
+        case WSAENETRESET :    return sfSocketDisconnected;
+        case WSAENOTCONN :     return sfSocketDisconnected;
+        default :              return sfSocketError;
+    }
+
+#else
+
+    // The error codes in EINPROGRESS and EWOULDBLOCK are the same as EAGAIN on most systems
+    if ((errno == EAGAIN) || (errno == EINPROGRESS) || (errno == EWOULDBLOCK))
+        return sfSocketNotReady;
+
+    switch (errno)
+    {
+        case ECONNABORTED : return sfSocketDisconnected;
+        case ECONNRESET :   return sfSocketDisconnected;
+        case ETIMEDOUT :    return sfSocketDisconnected;
+        case ENETRESET :    return sfSocketDisconnected;
+        case ENOTCONN :     return sfSocketDisconnected;
+        case EPIPE :        return sfSocketDisconnected;
+        default :           return sfSocketError;
+    }
+
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus SendSocketBuffers(sf::SocketHandle handle, const sfSocketBuffer* buffers, size_t count, const sf::Uint32* address, unsigned short port)
+{
+    sockaddr_in destination;
+    if (address)
+    {
+        std::memset(&destination, 0, sizeof(destination));
+        destination.sin_family = AF_INET;
+        destination.sin_addr.s_addr = htonl(*address);
+        destination.sin_port = htons(port);
+    }
+
+    // Copy the buffer descriptions, as they are modified when a write is partial
+    Buffer local[16];
+    std::vector<Buffer> allocated;
+    Buffer* pending = local;
+    if (count > 16)
+    {
+        allocated.resize(count);
+        pending = &allocated[0];
+    }
+    for (size_t i = 0; i < count; ++i)
+        SetBuffer(pending[i], buffers[i].Data, buffers[i].Size);
+
+    // A datagram is always sent whole, in a single call
+    if (address)
+        return SendOnce(handle, pending, count, &destination) < 0 ? GetSocketErrorStatus() : sfSocketDone;
+
+    size_t first = 0;
+    for (;;)
+    {
+        while ((first < count) && (GetSize(pending[first]) == 0))
+            first++;
+        if (first == count)
+            return sfSocketDone;
+
+        long sent = SendOnce(handle, pending + first, std::min(count - first, MaxBuffers), NULL);
+        if (sent < 0)
+            return GetSocketErrorStatus();
+
+        // Skip what was sent, and continue from the middle of a buffer if needed
+        size_t remaining = static_cast<size_t>(sent);
+        while (remaining > 0)
+        {
+            size_t size = GetSize(pending[first]);
+            if (remaining >= size)
+            {
+                remaining -= size;
+                SetBuffer(pending[first++], NULL, 0);
+            }
+            else
+            {
+                SetBuffer(pending[first], GetData(pending[first]) + remaining, size - remaining);
+                remaining = 0;
+            }
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus ReceiveSocketDatagram(sf::SocketHandle handle, sfUdpDatagram& datagram)
+{
+    sockaddr_in sender;
+    std::memset(&sender, 0, sizeof(sender));
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+
+    // The first MaxSize bytes of an oversized datagram are received, but the call fails with WSAEMSGSIZE
+    int senderSize = sizeof(sender);
+    int size = recvfrom(handle, datagram.Data, static_cast<int>(datagram.MaxSize), 0, reinterpret_cast<sockaddr*>(&sender), &senderSize);
+    if (size == SOCKET_ERROR)
+    {
+        if (WSAGetLastError() != WSAEMSGSIZE)
+            return GetSocketErrorStatus();
+
+        datagram.Size = datagram.MaxSize;
+        datagram.Truncated = sfTrue;
+    }
+    else
+    {
+        datagram.Size = static_cast<size_t>(size);
+        datagram.Truncated = sfFalse;
+    }
+
+#else
+
+    // recvfrom would silently truncate oversized datagrams, recvmsg tells it with MSG_TRUNC
+    Buffer buffer;
+    SetBuffer(buffer, datagram.Data, datagram.MaxSize);
+
+    msghdr message;
+    std::memset(&message, 0, sizeof(message));
+    message.msg_name = &sender;
+    message.msg_namelen = sizeof(sender);
+    message.msg_iov = &buffer;
+    message.msg_iovlen = 1;
+
+    ssize_t size = recvmsg(handle, &message, 0);
+    if (size < 0)
+        return GetSocketErrorStatus();
+
+    datagram.Size = static_cast<size_t>(size);
+    datagram.Truncated = (message.msg_flags & MSG_TRUNC) ? sfTrue : sfFalse;
+
+#endif
+
+    datagram.Address = ntohl(sender.sin_addr.s_addr);
+    datagram.Port = ntohs(sender.sin_port);
+
+    return sfSocketDone;
+}
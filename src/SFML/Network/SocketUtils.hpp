@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SOCKETUTILS_H
+#define SFML_SOCKETUTILS_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Network/SocketBuffer.h>
+#include <SFML/Network/SocketStatus.h>
+#include <SFML/Network/UdpSocket.h>
+#include <SFML/Network/SocketHandle.hpp>
+#include <SFML/Config.hpp>
+
+
+////////////////////////////////////////////////////////////
+// Convert the last socket error to a status, like SFML does internally
+////////////////////////////////////////////////////////////
+sfSocketStatus GetSocketErrorStatus();
+
+
+////////////////////////////////////////////////////////////
+// Send several buffers with gathered writes (sendmsg / WSASend).
+// If address is not NULL, the buffers are sent as a single datagram
+// to address:port; otherwise they are sent on a connected stream
+// socket, and partial writes are continued until everything is sent
+////////////////////////////////////////////////////////////
+sfSocketStatus SendSocketBuffers(sf::SocketHandle handle, const sfSocketBuffer* buffers, size_t count, const sf::Uint32* address, unsigned short port);
+
+
+////////////////////////////////////////////////////////////
+// Receive a single datagram into datagram.Data (recvmsg / recvfrom).
+// A datagram larger than datagram.MaxSize is truncated, and flagged
+// as such, instead of being reported as an error
+////////////////////////////////////////////////////////////
+sfSocketStatus ReceiveSocketDatagram(sf::SocketHandle handle, sfUdpDatagram& datagram);
+
+
+#endif // SFML_SOCKETUTILS_H
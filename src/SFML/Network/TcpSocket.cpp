@@ -28,6 +28,7 @@
 #include <SFML/Network/TcpSocket.h>
 #include <SFML/Network/TcpSocketStruct.h>
 #include <SFML/Network/PacketStruct.h>
+#include <SFML/Network/SocketUtils.hpp>
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Internal.h>
 #include <string.h>
@@ -81,6 +82,15 @@ sfIpAddress sfTcpSocket_GetRemoteAddress(const sfTcpSocket* socket)
 }
 
 
+////////////////////////////////////////////////////////////
+sfUint32 sfTcpSocket_GetRemoteAddressInteger(const sfTcpSocket* socket)
+{
+    CSFML_CHECK_RETURN(socket, 0);
+
+    return socket->This.GetRemoteAddress().ToInteger();
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned short sfTcpSocket_GetRemotePort(const sfTcpSocket* socket)
 {
@@ -99,6 +109,15 @@ sfSocketStatus sfTcpSocket_Connect(sfTcpSocket* socket, sfIpAddress host, unsign
 }
 
 
+////////////////////////////////////////////////////////////
+sfSocketStatus sfTcpSocket_ConnectTo(sfTcpSocket* socket, sfUint32 address, unsigned short port, sfTime timeout)
+{
+    CSFML_CHECK_RETURN(socket, sfSocketError);
+
+    return static_cast<sfSocketStatus>(socket->This.Connect(sf::IpAddress(address), port, sf::Microseconds(timeout.Microseconds)));
+}
+
+
 ////////////////////////////////////////////////////////////
 void sfTcpSocket_Disconnect(sfTcpSocket* socket)
 {
@@ -115,6 +134,16 @@ sfSocketStatus sfTcpSocket_Send(sfTcpSocket* socket, const char* data, size_t si
 }
 
 
+////////////////////////////////////////////////////////////
+sfSocketStatus sfTcpSocket_SendV(sfTcpSocket* socket, const sfSocketBuffer* buffers, size_t count)
+{
+    CSFML_CHECK_RETURN(socket, sfSocketError);
+    CSFML_CHECK_RETURN(buffers, sfSocketError);
+
+    return SendSocketBuffers(socket->This.GetHandle(), buffers, count, NULL, 0);
+}
+
+
 ////////////////////////////////////////////////////////////
 sfSocketStatus sfTcpSocket_Receive(sfTcpSocket* socket, char* data, size_t maxSize, size_t* sizeReceived)
 {
@@ -138,7 +167,15 @@ sfSocketStatus sfTcpSocket_SendPacket(sfTcpSocket* socket, sfPacket* packet)
     CSFML_CHECK_RETURN(socket, sfSocketError);
     CSFML_CHECK_RETURN(packet, sfSocketError);
 
-    return static_cast<sfSocketStatus>(socket->This.Send(packet->This));
+    // Send the size prefix (32 bits, big endian) and the data with a single gathered write,
+    // in the same format as sf::TcpSocket::Send(Packet&)
+    sf::Uint32 size = static_cast<sf::Uint32>(packet->GetDataSize());
+    sf::Uint8 header[4] = {static_cast<sf::Uint8>(size >> 24), static_cast<sf::Uint8>(size >> 16),
+                           static_cast<sf::Uint8>(size >> 8),  static_cast<sf::Uint8>(size)};
+
+    sfSocketBuffer buffers[2] = {{header, sizeof(header)}, {packet->GetData(), size}};
+
+    return SendSocketBuffers(socket->This.GetHandle(), buffers, 2, NULL, 0);
 }
 
 
@@ -148,5 +185,7 @@ sfSocketStatus sfTcpSocket_ReceivePacket(sfTcpSocket* socket, sfPacket* packet)
     CSFML_CHECK_RETURN(socket, sfSocketError);
     CSFML_CHECK_RETURN(packet, sfSocketError);
 
+    packet->Clear();
+
     return static_cast<sfSocketStatus>(socket->This.Receive(packet->This));
 }
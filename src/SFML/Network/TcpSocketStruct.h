@@ -31,12 +31,23 @@
 #include <SFML/Network/TcpSocket.hpp>
 
 
+////////////////////////////////////////////////////////////
+// sf::TcpSocket giving access to its native handle
+////////////////////////////////////////////////////////////
+class sfTcpSocketImpl : public sf::TcpSocket
+{
+public :
+
+    using sf::TcpSocket::GetHandle;
+};
+
+
 ////////////////////////////////////////////////////////////
 // Internal structure of sfTcpSocket
 ////////////////////////////////////////////////////////////
 struct sfTcpSocket
 {
-    sf::TcpSocket This;
+    sfTcpSocketImpl This;
 };
 
 
@@ -28,10 +28,53 @@
 #include <SFML/Network/UdpSocket.h>
 #include <SFML/Network/UdpSocketStruct.h>
 #include <SFML/Network/PacketStruct.h>
+#include <SFML/Network/SocketUtils.hpp>
 #include <SFML/Network/IpAddress.hpp>
 #include <SFML/Internal.h>
+#include <algorithm>
 #include <string.h>
 
+#if defined(CSFML_SYSTEM_LINUX)
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <arpa/inet.h>
+#endif
+
+
+namespace
+{
+#if defined(CSFML_SYSTEM_LINUX)
+
+    // Maximum number of datagrams moved by a single system call
+    const size_t MaxBatchSize = 64;
+
+    // Fill the message headers of a chunk of datagrams
+    void PrepareMessages(mmsghdr* messages, iovec* buffers, sockaddr_in* addresses, const sfUdpDatagram* datagrams, size_t count, bool sending)
+    {
+        memset(messages, 0, count * sizeof(mmsghdr));
+        memset(addresses, 0, count * sizeof(sockaddr_in));
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (sending)
+            {
+                addresses[i].sin_family = AF_INET;
+                addresses[i].sin_addr.s_addr = htonl(datagrams[i].Address);
+                addresses[i].sin_port = htons(datagrams[i].Port);
+            }
+
+            buffers[i].iov_base = datagrams[i].Data;
+            buffers[i].iov_len = sending ? datagrams[i].Size : datagrams[i].MaxSize;
+
+            messages[i].msg_hdr.msg_name = &addresses[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+#endif
+}
+
 
 ////////////////////////////////////////////////////////////
 sfUdpSocket* sfUdpSocket_Create(void)
@@ -131,7 +174,7 @@ sfSocketStatus sfUdpSocket_SendPacket(sfUdpSocket* socket, sfPacket* packet, sfI
     // Convert the address
     sf::IpAddress receiver(address.Address);
 
-    return static_cast<sfSocketStatus>(socket->This.Send(packet->This, receiver, port));
+    return static_cast<sfSocketStatus>(socket->This.Send(packet->GetData(), packet->GetDataSize(), receiver, port));
 }
 
 
@@ -141,6 +184,8 @@ sfSocketStatus sfUdpSocket_ReceivePacket(sfUdpSocket* socket, sfPacket* packet,
     CSFML_CHECK_RETURN(socket, sfSocketError);
     CSFML_CHECK_RETURN(packet, sfSocketError);
 
+    packet->Clear();
+
     sf::IpAddress sender;
     unsigned short senderPort;
     sf::Socket::Status status = socket->This.Receive(packet->This, sender, senderPort);
@@ -157,6 +202,225 @@ sfSocketStatus sfUdpSocket_ReceivePacket(sfUdpSocket* socket, sfPacket* packet,
 }
 
 
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpSocket_SendTo(sfUdpSocket* socket, const char* data, size_t size, sfUint32 address, unsigned short port)
+{
+    CSFML_CHECK_RETURN(socket, sfSocketError);
+
+    return static_cast<sfSocketStatus>(socket->This.Send(data, size, sf::IpAddress(address), port));
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpSocket_ReceiveFrom(sfUdpSocket* socket, char* data, size_t maxSize, size_t* sizeReceived, sfUint32* address, unsigned short* port)
+{
+    CSFML_CHECK_RETURN(socket, sfSocketError);
+
+    sf::IpAddress sender;
+    unsigned short senderPort;
+    std::size_t received;
+
+    sf::Socket::Status status = socket->This.Receive(data, maxSize, received, sender, senderPort);
+    if (status != sf::Socket::Done)
+        return static_cast<sfSocketStatus>(status);
+
+    if (sizeReceived)
+        *sizeReceived = received;
+
+    if (address)
+        *address = sender.ToInteger();
+
+    if (port)
+        *port = senderPort;
+
+    return sfSocketDone;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpSocket_SendPacketTo(sfUdpSocket* socket, sfPacket* packet, sfUint32 address, unsigned short port)
+{
+    CSFML_CHECK_RETURN(socket, sfSocketError);
+    CSFML_CHECK_RETURN(packet, sfSocketError);
+
+    return static_cast<sfSocketStatus>(socket->This.Send(packet->GetData(), packet->GetDataSize(), sf::IpAddress(address), port));
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpSocket_ReceivePacketFrom(sfUdpSocket* socket, sfPacket* packet, sfUint32* address, unsigned short* port)
+{
+    CSFML_CHECK_RETURN(socket, sfSocketError);
+    CSFML_CHECK_RETURN(packet, sfSocketError);
+
+    packet->Clear();
+
+    sf::IpAddress sender;
+    unsigned short senderPort;
+    sf::Socket::Status status = socket->This.Receive(packet->This, sender, senderPort);
+    if (status != sf::Socket::Done)
+        return static_cast<sfSocketStatus>(status);
+
+    if (address)
+        *address = sender.ToInteger();
+
+    if (port)
+        *port = senderPort;
+
+    return sfSocketDone;
+}
+
+
+////////////////////////////////////////////////////////////
+sfSocketStatus sfUdpSocket_SendV(sfUdpSocket* socket, const sfSocketBuffer* buffers, size_t count, sfUint32 address, unsigned short port)
+{
+    CSFML_CHECK_RETURN(socket, sfSocketError);
+    CSFML_CHECK_RETURN(buffers, sfSocketError);
+
+    size_t size = 0;
+    for (size_t i = 0; i < count; ++i)
+        size += buffers[i].Size;
+    if (size > sf::UdpSocket::MaxDatagramSize)
+        return sfSocketError;
+
+    socket->This.Create();
+
+    return SendSocketBuffers(socket->This.GetHandle(), buffers, count, &address, port);
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfUdpSocket_SendBatch(sfUdpSocket* socket, const sfUdpDatagram* datagrams, size_t count, sfSocketStatus* status)
+{
+    sfSocketStatus result = sfSocketDone;
+    size_t sent = 0;
+
+    if (!socket || (!datagrams && (count > 0)))
+        result = sfSocketError;
+
+#if defined(CSFML_SYSTEM_LINUX)
+
+    // Send the datagrams by chunks with sendmmsg; oversized datagrams are refused like sf::UdpSocket does
+    mmsghdr messages[MaxBatchSize];
+    iovec buffers[MaxBatchSize];
+    sockaddr_in addresses[MaxBatchSize];
+
+    if (result == sfSocketDone)
+        socket->This.Create();
+
+    while ((result == sfSocketDone) && (sent < count))
+    {
+        size_t chunk = 0;
+        while ((chunk < std::min(count - sent, MaxBatchSize)) && (datagrams[sent + chunk].Size <= sf::UdpSocket::MaxDatagramSize))
+            chunk++;
+
+        if (chunk == 0)
+        {
+            result = sfSocketError;
+            break;
+        }
+
+        PrepareMessages(messages, buffers, addresses, datagrams + sent, chunk, true);
+        int done = sendmmsg(socket->This.GetHandle(), messages, static_cast<unsigned int>(chunk), 0);
+        if (done < 0)
+        {
+            result = GetSocketErrorStatus();
+            break;
+        }
+
+        sent += done;
+    }
+
+#else
+
+    while ((result == sfSocketDone) && (sent < count))
+    {
+        const sfUdpDatagram& datagram = datagrams[sent];
+        result = static_cast<sfSocketStatus>(socket->This.Send(datagram.Data, datagram.Size, sf::IpAddress(datagram.Address), datagram.Port));
+        if (result == sfSocketDone)
+            sent++;
+    }
+
+#endif
+
+    if (status)
+        *status = result;
+
+    return sent;
+}
+
+
+////////////////////////////////////////////////////////////
+size_t sfUdpSocket_ReceiveBatch(sfUdpSocket* socket, sfUdpDatagram* datagrams, size_t count, sfSocketStatus* status)
+{
+    sfSocketStatus result = sfSocketDone;
+    size_t received = 0;
+
+    if (!socket || !datagrams || (count == 0))
+        result = sfSocketError;
+
+#if defined(CSFML_SYSTEM_LINUX)
+
+    // A single recvmmsg call: MSG_WAITFORONE makes it stop blocking once a datagram is received
+    mmsghdr messages[MaxBatchSize];
+    iovec buffers[MaxBatchSize];
+    sockaddr_in addresses[MaxBatchSize];
+
+    if (result == sfSocketDone)
+    {
+        size_t chunk = std::min(count, MaxBatchSize);
+        PrepareMessages(messages, buffers, addresses, datagrams, chunk, false);
+
+        int flags = socket->This.IsBlocking() ? MSG_WAITFORONE : 0;
+        int done = recvmmsg(socket->This.GetHandle(), messages, static_cast<unsigned int>(chunk), flags, NULL);
+        if (done < 0)
+        {
+            result = GetSocketErrorStatus();
+        }
+        else
+        {
+            for (received = 0; received < static_cast<size_t>(done); ++received)
+            {
+                sfUdpDatagram& datagram = datagrams[received];
+                datagram.Size = std::min<size_t>(messages[received].msg_len, datagram.MaxSize);
+                datagram.Truncated = (messages[received].msg_hdr.msg_flags & MSG_TRUNC) ? sfTrue : sfFalse;
+                datagram.Address = ntohl(addresses[received].sin_addr.s_addr);
+                datagram.Port = ntohs(addresses[received].sin_port);
+            }
+        }
+    }
+
+#else
+
+    // Receive the first datagram normally, and the next ones only if they are already available;
+    // sf::UdpSocket::Receive is not used, as it reports oversized datagrams as errors on Windows
+    bool blocking = socket && socket->This.IsBlocking();
+    while ((result == sfSocketDone) && (received < count))
+    {
+        sfSocketStatus datagramStatus = ReceiveSocketDatagram(socket->This.GetHandle(), datagrams[received]);
+        if (datagramStatus != sfSocketDone)
+        {
+            if (received == 0)
+                result = datagramStatus;
+            break;
+        }
+
+        if ((received++ == 0) && blocking)
+            socket->This.SetBlocking(false);
+    }
+
+    if (blocking)
+        socket->This.SetBlocking(true);
+
+#endif
+
+    if (status)
+        *status = result;
+
+    return received;
+}
+
+
 ////////////////////////////////////////////////////////////
 unsigned int sfUdpSocket_MaxDatagramSize()
 {
@@ -31,12 +31,24 @@
 #include <SFML/Network/UdpSocket.hpp>
 
 
+////////////////////////////////////////////////////////////
+// sf::UdpSocket giving access to its native handle
+////////////////////////////////////////////////////////////
+class sfUdpSocketImpl : public sf::UdpSocket
+{
+public :
+
+    using sf::UdpSocket::GetHandle;
+    using sf::UdpSocket::Create;
+};
+
+
 ////////////////////////////////////////////////////////////
 // Internal structure of sfUdpSocket
 ////////////////////////////////////////////////////////////
 struct sfUdpSocket
 {
-    sf::UdpSocket This;
+    sfUdpSocketImpl This;
 };
 
 
@@ -0,0 +1,48 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+#ifndef SFML_SIMD_H
+#define SFML_SIMD_H
+
+////////////////////////////////////////////////////////////
+// Detect the SIMD instruction sets available at compile time;
+// code using them must always provide a scalar fallback
+////////////////////////////////////////////////////////////
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+
+    // SSE2 (always available on x86-64)
+    #include <emmintrin.h>
+    #define CSFML_SIMD_SSE2
+
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+    // NEON (ARMv7 with NEON, ARMv8)
+    #include <arm_neon.h>
+    #define CSFML_SIMD_NEON
+
+#endif
+
+
+#endif // SFML_SIMD_H
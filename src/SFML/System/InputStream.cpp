@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////
+//
+// SFML - Simple and Fast Multimedia Library
+// Copyright (C) 2007-2009 Laurent Gomila (laurent.gom@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/System/InputStream.h>
+#include <SFML/Internal.h>
+#include <algorithm>
+#include <cstring>
+
+#if defined(CSFML_SYSTEM_WINDOWS)
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+
+namespace
+{
+    // Stream over a mapped file; the callbacks receive it as their user data
+    struct MappedFile
+    {
+        sfInputStream Stream;
+        const char*   Data;
+        sfInt64       Size;
+        sfInt64       Position;
+    #if defined(CSFML_SYSTEM_WINDOWS)
+        HANDLE        Mapping;
+    #endif
+    };
+
+    sfInt64 Read(char* data, sfInt64 size, void* userData)
+    {
+        MappedFile* file = static_cast<MappedFile*>(userData);
+
+        sfInt64 count = std::max<sfInt64>(std::min(size, file->Size - file->Position), 0);
+        if (count > 0)
+        {
+            std::memcpy(data, file->Data + file->Position, static_cast<size_t>(count));
+            file->Position += count;
+        }
+
+        return count;
+    }
+
+    sfInt64 Seek(sfInt64 position, void* userData)
+    {
+        MappedFile* file = static_cast<MappedFile*>(userData);
+
+        if (position < 0)
+            return -1;
+
+        file->Position = std::min(position, file->Size);
+
+        return file->Position;
+    }
+
+    sfInt64 Tell(void* userData)
+    {
+        return static_cast<MappedFile*>(userData)->Position;
+    }
+
+    sfInt64 GetSize(void* userData)
+    {
+        return static_cast<MappedFile*>(userData)->Size;
+    }
+
+    // Map a whole file in memory, read-only; an empty file gives no data
+    bool Map(MappedFile* file, const char* filename, sfInputStreamAccess access)
+    {
+    #if defined(CSFML_SYSTEM_WINDOWS)
+
+        // Windows has no advice for mapped views, but the same hints can be given to the file
+        DWORD flags = FILE_ATTRIBUTE_NORMAL;
+        if (access == sfInputStreamAccessSequential)
+            flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+        else if (access == sfInputStreamAccessRandom)
+            flags |= FILE_FLAG_RANDOM_ACCESS;
+
+        HANDLE handle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, flags, NULL);
+        if (handle == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(handle, &size))
+        {
+            CloseHandle(handle);
+            return false;
+        }
+
+        file->Size = size.QuadPart;
+        if (file->Size > 0)
+        {
+            // The view keeps the mapping alive, the mapping keeps the file alive
+            file->Mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (file->Mapping)
+                file->Data = static_cast<const char*>(MapViewOfFile(file->Mapping, FILE_MAP_READ, 0, 0, 0));
+        }
+        CloseHandle(handle);
+
+        if ((file->Size > 0) && !file->Data)
+        {
+            if (file->Mapping)
+                CloseHandle(file->Mapping);
+            return false;
+        }
+
+        return true;
+
+    #else
+
+        int handle = open(filename, O_RDONLY);
+        if (handle < 0)
+            return false;
+
+        struct stat status;
+        if (fstat(handle, &status) != 0)
+        {
+            close(handle);
+            return false;
+        }
+
+        // The mapping stays valid after the file is closed
+        file->Size = status.st_size;
+        if (file->Size > 0)
+        {
+            void* data = mmap(NULL, static_cast<size_t>(file->Size), PROT_READ, MAP_PRIVATE, handle, 0);
+            if (data != MAP_FAILED)
+            {
+                file->Data = static_cast<const char*>(data);
+
+                int advice = MADV_NORMAL;
+                if (access == sfInputStreamAccessSequential)
+                    advice = MADV_SEQUENTIAL;
+                else if (access == sfInputStreamAccessRandom)
+                    advice = MADV_RANDOM;
+                madvise(data, static_cast<size_t>(file->Size), advice);
+            }
+        }
+        close(handle);
+
+        return (file->Size == 0) || file->Data;
+
+    #endif
+    }
+
+    void Unmap(MappedFile* file)
+    {
+        if (!file->Data)
+            return;
+
+    #if defined(CSFML_SYSTEM_WINDOWS)
+        UnmapViewOfFile(file->Data);
+        CloseHandle(file->Mapping);
+    #else
+        munmap(const_cast<char*>(file->Data), static_cast<size_t>(file->Size));
+    #endif
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sfInputStream* sfInputStream_CreateFromMappedFile(const char* filename, sfInputStreamAccess access)
+{
+    CSFML_CHECK_RETURN(filename, NULL);
+
+    MappedFile* file = new MappedFile;
+    file->Data = NULL;
+    file->Size = 0;
+    file->Position = 0;
+#if defined(CSFML_SYSTEM_WINDOWS)
+    file->Mapping = NULL;
+#endif
+
+    if (!Map(file, filename, access))
+    {
+        delete file;
+        return NULL;
+    }
+
+    file->Stream.Read = &Read;
+    file->Stream.Seek = &Seek;
+    file->Stream.Tell = &Tell;
+    file->Stream.GetSize = &GetSize;
+    file->Stream.UserData = file;
+
+    return &file->Stream;
+}
+
+
+////////////////////////////////////////////////////////////
+void sfInputStream_DestroyMappedFile(sfInputStream* stream)
+{
+    if (!stream)
+        return;
+
+    // Only our own streams point to a MappedFile
+    if (stream->Read != &Read)
+        return;
+
+    MappedFile* file = static_cast<MappedFile*>(stream->UserData);
+    Unmap(file);
+
+    delete file;
+}